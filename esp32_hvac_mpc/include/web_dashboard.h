@@ -21,18 +21,56 @@ extern int sunriseMin;
 extern int sunsetHour;
 extern int sunsetMin;
 
+// /api/status is serialized into one of two buffers at most once per
+// STATUS_MAX_AGE_MS (the readings behind it change on their own intervals)
+// and served from there. A copy equal to the current one is dropped, so
+// the ETag only changes with the content.
+#define STATUS_BUFFER_SIZE 512
+#define STATUS_MAX_AGE_MS  1000
+
 class WebDashboard {
+    friend class StatusHandler;
+
 public:
     WebDashboard();
     void begin();
 
 private:
     AsyncWebServer server;
+
+    char statusJson[2][STATUS_BUFFER_SIZE];
+    size_t statusLen[2] = {0, 0};
+    uint32_t statusHash[2] = {0, 0};
+    uint8_t statusCurrent = 0;
+    uint8_t statusInFlight[2] = {0, 0}; // 200 responses still streaming each copy
+    bool statusValid = false;
+    unsigned long statusBuiltAt = 0;
     
     void setupRoutes();
+    void refreshStatus();
+    void handleStatus(AsyncWebServerRequest *request);
     static String processor(const String& var);
 };
 
+// /api/status, declared as a handler rather than with server.on() so it
+// can ask for If-None-Match: the server drops headers no handler asked for
+class StatusHandler : public AsyncWebHandler {
+public:
+    StatusHandler(WebDashboard *dashboard) : dashboard(dashboard) {}
+
+    bool canHandle(AsyncWebServerRequest *request) override {
+        if (request->method() != HTTP_GET || request->url() != "/api/status") return false;
+        request->addInterestingHeader("If-None-Match");
+        return true;
+    }
+    void handleRequest(AsyncWebServerRequest *request) override {
+        dashboard->handleStatus(request);
+    }
+
+private:
+    WebDashboard *dashboard;
+};
+
 // Implementation
 WebDashboard::WebDashboard() : server(WEB_SERVER_PORT) {}
 
@@ -45,34 +83,12 @@ void WebDashboard::begin() {
 }
 
 void WebDashboard::setupRoutes() {
-    // Serve static files
-    server.serveStatic("/", SPIFFS, "/").setDefaultFile("index.html");
+    // Serve static files, gzipped by tools/build_web_assets.py; serveStatic()
+    // sends name.gz for name
+    server.serveStatic("/", SPIFFS, "/").setDefaultFile("index.html").setCacheControl("max-age=60");
     
     // API: Status
-    server.on("/api/status", HTTP_GET, [](AsyncWebServerRequest *request){
-        JsonDocument doc;
-        doc["mode"] = mpc.getStateName();
-        doc["temp"] = tempSensor.getTempF();
-        doc["outside"] = outsideTemp;
-        doc["target"] = mpc.getTargetTemp();
-        doc["heatRate"] = mpc.getCurrentHeatRate();
-        doc["tempBin"] = mpc.getCurrentBinLabel();
-        doc["presence"] = presence.isAnyoneHome() ? "HOME" : "AWAY";
-        doc["heatOn"] = mpc.shouldHeat();
-        doc["dynamicCoast"] = mpc.getDynamicCoast();
-        doc["sunrise"] = String(sunriseHour) + ":" + (sunriseMin < 10 ? "0" : "") + String(sunriseMin);
-        doc["sunset"] = String(sunsetHour) + ":" + (sunsetMin < 10 ? "0" : "") + String(sunsetMin);
-        
-        // Relays
-        JsonObject relayObj = doc["relays"].to<JsonObject>();
-        relayObj["heat"] = relays.isHeatOn();
-        relayObj["cool"] = relays.isCoolOn();
-        relayObj["fan"] = relays.isFanOn();
-        
-        String response;
-        serializeJson(doc, response);
-        request->send(200, "application/json", response);
-    });
+    server.addHandler(new StatusHandler(this));
     
     // API: Heat Rates (Brain)
     server.on("/api/brain", HTTP_GET, [](AsyncWebServerRequest *request){
@@ -85,4 +101,84 @@ void WebDashboard::setupRoutes() {
     });
 }
 
+void WebDashboard::refreshStatus() {
+    unsigned long now = millis();
+    if (statusValid && now - statusBuiltAt < STATUS_MAX_AGE_MS) return;
+
+    // Into the buffer not being served. beginResponse_P() streams from it as
+    // the client reads, so it can't be rewritten while a slow client is
+    // still on it; keep serving the current one until it's free
+    uint8_t next = statusValid ? 1 - statusCurrent : 0;
+    if (statusInFlight[next]) return;
+    statusBuiltAt = now;
+
+    JsonDocument doc;
+    doc["mode"] = mpc.getStateName();
+    doc["temp"] = tempSensor.getTempF();
+    doc["outside"] = outsideTemp;
+    doc["target"] = mpc.getTargetTemp();
+    doc["heatRate"] = mpc.getCurrentHeatRate();
+    doc["tempBin"] = mpc.getCurrentBinLabel();
+    doc["presence"] = presence.isAnyoneHome() ? "HOME" : "AWAY";
+    doc["heatOn"] = mpc.shouldHeat();
+    doc["dynamicCoast"] = mpc.getDynamicCoast();
+    char clock[6];
+    snprintf(clock, sizeof(clock), "%d:%02d", sunriseHour, sunriseMin);
+    doc["sunrise"] = clock;
+    snprintf(clock, sizeof(clock), "%d:%02d", sunsetHour, sunsetMin);
+    doc["sunset"] = clock;
+    
+    // Relays
+    JsonObject relayObj = doc["relays"].to<JsonObject>();
+    relayObj["heat"] = relays.isHeatOn();
+    relayObj["cool"] = relays.isCoolOn();
+    relayObj["fan"] = relays.isFanOn();
+
+    size_t len = serializeJson(doc, statusJson[next], STATUS_BUFFER_SIZE);
+    if (len == 0 || len >= STATUS_BUFFER_SIZE - 1) {
+        Serial.println("[Web] Status JSON exceeds STATUS_BUFFER_SIZE!");
+        return;
+    }
+
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        hash ^= (uint8_t)statusJson[next][i];
+        hash *= 16777619u;
+    }
+    if (statusValid && hash == statusHash[statusCurrent] && len == statusLen[statusCurrent]) return;
+
+    statusLen[next] = len;
+    statusHash[next] = hash;
+    statusCurrent = next;
+    statusValid = true;
+}
+
+// Requests share the cached bytes; a client sending back the ETag of the
+// current copy gets a 304 without them
+void WebDashboard::handleStatus(AsyncWebServerRequest *request) {
+    refreshStatus();
+    if (!statusValid) {
+        request->send(500, "application/json", "{\"error\":\"Status unavailable\"}");
+        return;
+    }
+
+    char etag[12];
+    snprintf(etag, sizeof(etag), "\"%08x\"", (unsigned)statusHash[statusCurrent]);
+    AsyncWebServerResponse *response;
+    AsyncWebHeader *match = request->getHeader("If-None-Match");
+    if (match && match->value() == etag) {
+        response = request->beginResponse(304);
+    } else {
+        uint8_t current = statusCurrent;
+        response = request->beginResponse_P(200, "application/json",
+            (const uint8_t*)statusJson[current], statusLen[current]);
+        statusInFlight[current]++;
+        request->onDisconnect([this, current]() { statusInFlight[current]--; });
+    }
+    response->addHeader("ETag", etag);
+    response->addHeader("Cache-Control", "no-cache");
+    request->send(response);
+}
+
 #endif // WEB_DASHBOARD_H
@@ -35,6 +35,7 @@ SSD1306::SSD1306(int i2cAddress, int sda, int sdc) {
   mySda = sda;
   mySdc = sdc;
   I2C_io = true;
+  invalidate();
 }
 
 // constructor for hardware SPI - we indicate Reset, DataCommand and ChipSelect 
@@ -44,6 +45,7 @@ SSD1306::SSD1306(bool HW_SPI, int rst, int dc, int cs ) {
   myDC = dc;
   myCS = cs;
   I2C_io = false;
+  invalidate();
 }
 
 void SSD1306::init() {
@@ -72,6 +74,7 @@ void SSD1306::init() {
 void SSD1306::resetDisplay(void) {
   displayOff();
   clear();
+  invalidate();
   display();
   displayOn();
 }
@@ -103,60 +106,400 @@ void SSD1306::flipScreenVertically() {
 }
 
 void SSD1306::clear(void) {
-    memset(buffer, 0, (128 * 64 / 8));
+  // Only what was lit needs sending
+  for (int page = 0; page < 8; page++) {
+    uint8_t *row = buffer + page * 128;
+    int from = 0, to = 127;
+    while (from < 128 && row[from] == 0) from++;
+    if (from == 128) continue;
+    while (row[to] == 0) to--;
+    markDirty(from, page);
+    markDirty(to, page);
+  }
+  memset(buffer, 0, (128 * 64 / 8));
+}
+
+void SSD1306::invalidate(void) {
+  // The panel may hold anything: send everything, whatever the shadow says
+  myShownValid = false;
+  for (int page = 0; page < 8; page++) {
+    myDirtyFrom[page] = 0;
+    myDirtyTo[page] = 127;
+  }
+}
+
+void SSD1306::markDirty(int x, int page) {
+  if (x < myDirtyFrom[page]) myDirtyFrom[page] = x;
+  if (x > myDirtyTo[page]) myDirtyTo[page] = x;
+}
+
+// Bytes on the bus for a window of n data bytes: one command transfer
+// (address, control, 6 commands) plus 16 data bytes per transfer
+// (address, control, data)
+static uint16_t windowCost(uint8_t from, uint8_t to, uint8_t pages) {
+  uint16_t n = (to - from + 1) * pages;
+  return 8 + n + 2 * ((n + 15) / 16);
+}
+
+uint8_t SSD1306::planWindows(uint8_t windows[8][4], const uint8_t *frame, uint8_t *dirtyFrom, uint8_t *dirtyTo) {
+  if (myShown) {
+    // Narrow the changed columns to those that differ from what was sent
+    for (uint8_t page = 0; page < 8; page++) {
+      if (dirtyFrom[page] > dirtyTo[page]) continue;
+      const uint8_t *row = frame + page * 128;
+      uint8_t *shown = myShown + page * 128;
+      int from = dirtyFrom[page], to = dirtyTo[page];
+      if (myShownValid) {
+        while (from <= to && row[from] == shown[from]) from++;
+        while (to >= from && row[to] == shown[to]) to--;
+      }
+      if (from > to) {
+        dirtyFrom[page] = 0xFF;
+        dirtyTo[page] = 0;
+        continue;
+      }
+      memcpy(shown + from, row + from, to - from + 1);
+      dirtyFrom[page] = from;
+      dirtyTo[page] = to;
+    }
+    myShownValid = true;
+  }
+
+  uint8_t count = 0;
+  uint8_t page = 0;
+  while (page < 8) {
+    if (dirtyFrom[page] > dirtyTo[page]) {
+      page++;
+      continue;
+    }
+    uint8_t from = dirtyFrom[page];
+    uint8_t to = dirtyTo[page];
+    uint8_t last = page;
+    // Take the next page into the same window while that is cheaper than
+    // a window of its own
+    while (last < 7 && dirtyFrom[last + 1] <= dirtyTo[last + 1]) {
+      uint8_t nextFrom = min(from, dirtyFrom[last + 1]);
+      uint8_t nextTo = max(to, dirtyTo[last + 1]);
+      if (windowCost(nextFrom, nextTo, last + 2 - page) >
+          windowCost(from, to, last + 1 - page) + windowCost(dirtyFrom[last + 1], dirtyTo[last + 1], 1)) {
+        break;
+      }
+      from = nextFrom;
+      to = nextTo;
+      last++;
+    }
+    windows[count][0] = from;
+    windows[count][1] = to;
+    windows[count][2] = page;
+    windows[count][3] = last;
+    count++;
+    page = last + 1;
+  }
+
+  for (page = 0; page < 8; page++) {
+    dirtyFrom[page] = 0xFF;
+    dirtyTo[page] = 0;
+  }
+  return count;
 }
 
 void SSD1306::display(void) {
-    sendCommand(COLUMNADDR);
-    sendCommand(0x0);
-    sendCommand(0x7F);
+  if (myTx) {
+    // Behind the frame on the way, or merged into the one waiting for it
+    if (myTxBusy || myTxPending) queue();
+    if (!myTxBusy) snapshot();
+    return;
+  }
+
+  uint32_t start = micros();
+  myLastFlushBytes = 0;
+  uint8_t windows[8][4];
+  uint8_t count = planWindows(windows, buffer, myDirtyFrom, myDirtyTo);
+  for (uint8_t i = 0; i < count; i++) {
+    sendWindow(windows[i][0], windows[i][1], windows[i][2], windows[i][3]);
+  }
+  myLastFlushMicros = micros() - start;
+}
+
+void SSD1306::queue(void) {
+  // Copy the frame now, so drawing after this display() doesn't go out
+  // with it. All of it: a window also covers columns next to the changed
+  // ones. A display() already queued is merged in
+  memcpy(myNext, buffer, sizeof(buffer));
+  if (!myTxPending) {
+    for (uint8_t page = 0; page < 8; page++) {
+      myNextFrom[page] = 0xFF;
+      myNextTo[page] = 0;
+    }
+  }
+  for (uint8_t page = 0; page < 8; page++) {
+    if (myDirtyFrom[page] < myNextFrom[page]) myNextFrom[page] = myDirtyFrom[page];
+    if (myDirtyTo[page] > myNextTo[page]) myNextTo[page] = myDirtyTo[page];
+    myDirtyFrom[page] = 0xFF;
+    myDirtyTo[page] = 0;
+  }
+  myTxPending = true;
+}
+
+void SSD1306::snapshot(void) {
+  // The queued frame if there is one, else the buffer as it is now
+  const uint8_t *frame = myTxPending ? myNext : buffer;
+  myTxWindowCount = myTxPending ? planWindows(myTxWindows, myNext, myNextFrom, myNextTo)
+                                : planWindows(myTxWindows, buffer, myDirtyFrom, myDirtyTo);
+  myTxPending = false;
+  // The windows' bytes in the order the display takes them
+  uint16_t length = 0;
+  for (uint8_t i = 0; i < myTxWindowCount; i++) {
+    uint8_t from = myTxWindows[i][0];
+    uint8_t width = myTxWindows[i][1] - from + 1;
+    for (uint8_t page = myTxWindows[i][2]; page <= myTxWindows[i][3]; page++) {
+      memcpy(myTx + length, frame + page * 128 + from, width);
+      length += width;
+    }
+  }
+  myTxWindow = 0;
+  myTxPos = 0;
+  myTxWindowSent = 0;
+  myTxCommanded = false;
+  myTxBytes = 0;
+  myTxMicros = 0;
+  myTxBusy = myTxWindowCount > 0;
+}
+
+bool SSD1306::setFrameDiff(bool enabled) {
+  if (!enabled) {
+    free(myShown);
+    myShown = NULL;
+  } else if (!myShown) {
+    myShown = (uint8_t *) malloc(128 * 64 / 8);
+    if (!myShown) return false;
+    invalidate();
+  }
+  return true;
+}
 
-    sendCommand(PAGEADDR);
-    sendCommand(0x0);
-    sendCommand(0x7);
+bool SSD1306::setFlushBudget(uint16_t bytesPerService) {
+  if (bytesPerService == 0) {
+    // Finish what is on the way first
+    while (myTxBusy || myTxPending) service();
+    free(myTx);
+    free(myNext);
+    myTx = NULL;
+    myNext = NULL;
+  } else if (!myTx) {
+    myTx = (uint8_t *) malloc(128 * 64 / 8);
+    myNext = (uint8_t *) malloc(128 * 64 / 8);
+    if (!myTx || !myNext) {
+      free(myTx);
+      free(myNext);
+      myTx = NULL;
+      myNext = NULL;
+      return false;
+    }
+  }
+  myFlushBudget = bytesPerService;
+  return true;
+}
+
+bool SSD1306::service(void) {
+  if (!myTx) return false;
+  if (!myTxBusy) {
+    if (!myTxPending) return false;
+    snapshot();
+    if (!myTxBusy) return false;
+  }
+
+  uint32_t start = micros();
+  // Bus bytes of one more data transfer
+  const uint8_t chunk = I2C_io ? 16 + 2 : 16;
+  uint16_t spent = 0;
+  bool done = false;
+  do {
+    const uint8_t *window = myTxWindows[myTxWindow];
+    if (!myTxCommanded) {
+      const uint8_t commands[] = { COLUMNADDR, window[0], window[1], PAGEADDR, window[2], window[3] };
+      spent += sendCommands(commands, sizeof(commands));
+      myTxCommanded = true;
+      continue;
+    }
 
-	
+    uint16_t size = (window[1] - window[0] + 1) * (window[3] - window[2] + 1);
+    uint8_t count = min((uint16_t) 16, (uint16_t) (size - myTxWindowSent));
+    spent += sendData(myTx + myTxPos, count);
+    myTxPos += count;
+    myTxWindowSent += count;
+    if (myTxWindowSent == size) {
+      myTxWindowSent = 0;
+      myTxCommanded = false;
+      done = ++myTxWindow == myTxWindowCount;
+    }
+  } while (!done && spent + chunk <= myFlushBudget);
+
+  uint32_t elapsed = micros() - start;
+  if (elapsed > myMaxServiceMicros) myMaxServiceMicros = elapsed;
+  myTxBytes += spent;
+  myTxMicros += elapsed;
+  if (!done) return false;
+
+  myTxBusy = false;
+  myLastFlushBytes = myTxBytes;
+  myLastFlushMicros = myTxMicros;
+  return true;
+}
+
+uint16_t SSD1306::getFlushBudget(void) {
+  return myFlushBudget;
+}
+
+bool SSD1306::isFlushing(void) {
+  return myTxBusy || myTxPending;
+}
+
+uint32_t SSD1306::getMaxServiceMicros(void) {
+  uint32_t longest = myMaxServiceMicros;
+  myMaxServiceMicros = 0;
+  return longest;
+}
+
+uint8_t SSD1306::sendData(const uint8_t *data, uint8_t count) {
   if (I2C_io) {
-    for (uint16_t i=0; i<(128*64/8); i++) {
-      // send a bunch of data in one xmission
-      Wire.beginTransmission(myI2cAddress);
-      Wire.write(0x40);
-      for (uint8_t x=0; x<16; x++) {
-        Wire.write(buffer[i]);
-        i++;
+    Wire.beginTransmission(myI2cAddress);
+    Wire.write(0x40);
+    for (uint8_t i = 0; i < count; i++) {
+      Wire.write(data[i]);
+    }
+    Wire.endTransmission();
+    return count + 2;
+  }
+  digitalWrite(myCS, HIGH);
+  digitalWrite(myDC, HIGH);   // data mode
+  digitalWrite(myCS, LOW);
+  for (uint8_t i = 0; i < count; i++) {
+    SPI.transfer(data[i]);
+  }
+  digitalWrite(myCS, HIGH);
+  return count;
+}
+
+void SSD1306::sendWindow(uint8_t from, uint8_t to, uint8_t first, uint8_t last) {
+  const uint8_t window[] = { COLUMNADDR, from, to, PAGEADDR, first, last };
+  myLastFlushBytes += sendCommands(window, sizeof(window));
+
+  if (I2C_io) {
+    // The display walks the window left to right, then down a page
+    uint8_t sent = 0;
+    for (uint8_t page = first; page <= last; page++) {
+      for (uint8_t x = from; x <= to; x++) {
+        if (sent == 0) {
+          Wire.beginTransmission(myI2cAddress);
+          Wire.write(0x40);
+          myLastFlushBytes += 2;
+        }
+        Wire.write(buffer[x + page * 128]);
+        myLastFlushBytes++;
+        // send a bunch of data in one xmission
+        if (++sent == 16) {
+          yield();
+          Wire.endTransmission();
+          sent = 0;
+        }
       }
-      i--;
-      yield();
+    }
+    if (sent) {
       Wire.endTransmission();
     }
-  }	else {
-	digitalWrite(myCS, HIGH);
+  } else {
+    digitalWrite(myCS, HIGH);
     digitalWrite(myDC, HIGH);   // data mode
     digitalWrite(myCS, LOW);
-	for (uint16_t i=0; i<(128*64/8); i++) {
-	 SPI.transfer(buffer[i]);
-	}
-	digitalWrite(myCS, HIGH);	
+    for (uint8_t page = first; page <= last; page++) {
+      for (uint8_t x = from; x <= to; x++) {
+        SPI.transfer(buffer[x + page * 128]);
+        myLastFlushBytes++;
+      }
+    }
+    digitalWrite(myCS, HIGH);
   }
 }
 
+uint16_t SSD1306::getLastFlushBytes(void) {
+  return myLastFlushBytes;
+}
+
+uint32_t SSD1306::getLastFlushMicros(void) {
+  return myLastFlushMicros;
+}
+
 void SSD1306::setPixel(int x, int y) {
   if (x >= 0 && x < 128 && y >= 0 && y < 64) {
+     uint8_t *cell = &buffer[x + (y/8)*128];
+     uint8_t old = *cell;
 
      switch (myColor) {
-      case WHITE:   buffer[x + (y/8)*128] |=  (1 << (y&7)); break;
-      case BLACK:   buffer[x + (y/8)*128] &= ~(1 << (y&7)); break;
-      case INVERSE: buffer[x + (y/8)*128] ^=  (1 << (y&7)); break;
+      case WHITE:   *cell |=  (1 << (y&7)); break;
+      case BLACK:   *cell &= ~(1 << (y&7)); break;
+      case INVERSE: *cell ^=  (1 << (y&7)); break;
     }
+    if (*cell != old) markDirty(x, y / 8);
   }
 }
 
 void SSD1306::setChar(int x, int y, unsigned char data) {
-  for (int i = 0; i < 8; i++) {
-    if (bitRead(data, i)) {
-     setPixel(x,y + i);
+  if (x >= 0 && x < 128) drawColumn(x, y, data);
+}
+
+void SSD1306::drawColumn(int x, int y, uint8_t bits) {
+  // Every color as one expression: (old & ~(bits & clear)) ^ (bits & flip)
+  uint8_t clear = myColor == INVERSE ? 0x00 : 0xFF;
+  uint8_t flip = myColor == BLACK ? 0x00 : 0xFF;
+  // >> floors for y < 0 too
+  int page = y >> 3;
+  uint8_t shift = y & 7;
+  if (page >= 0 && page < 8) {
+    uint8_t *cell = &buffer[x + page * 128];
+    uint8_t set = bits << shift;
+    uint8_t old = *cell;
+    *cell = (old & ~(set & clear)) ^ (set & flip);
+    if (*cell != old) markDirty(x, page);
+  }
+  page++;
+  if (shift && page >= 0 && page < 8) {
+    uint8_t *cell = &buffer[x + page * 128];
+    uint8_t set = bits >> (8 - shift);
+    uint8_t old = *cell;
+    *cell = (old & ~(set & clear)) ^ (set & flip);
+    if (*cell != old) markDirty(x, page);
+  }
+}
+
+void SSD1306::fillColumns(int from, int to, int page, uint8_t mask) {
+  uint8_t *row = buffer + page * 128;
+  if (mask == 0xFF && myColor != INVERSE) {
+    // Whole bytes: set just the run between the first and last that differ
+    uint8_t fill = myColor == BLACK ? 0x00 : 0xFF;
+    while (from < to && row[from] == fill) from++;
+    if (from == to) return;
+    while (row[to - 1] == fill) to--;
+    memset(row + from, fill, to - from);
+    markDirty(from, page);
+    markDirty(to - 1, page);
+    return;
+  }
+
+  uint8_t clear = myColor == INVERSE ? 0x00 : mask;
+  uint8_t flip = myColor == BLACK ? 0x00 : mask;
+  int changedFrom = -1, changedTo = -1;
+  for (int x = from; x < to; x++) {
+    uint8_t old = row[x];
+    row[x] = (old & ~clear) ^ flip;
+    if (row[x] != old) {
+      if (changedFrom < 0) changedFrom = x;
+      changedTo = x;
     }
   }
+  if (changedFrom < 0) return;
+  markDirty(changedFrom, page);
+  markDirty(changedTo, page);
 }
 
 // Code form http://playground.arduino.cc/Main/Utf8ascii
@@ -191,8 +534,7 @@ String SSD1306::utf8ascii(String s) {
         return r;
 }
 
-void SSD1306::drawString(int x, int y, String text) {
-  text = utf8ascii(text);
+void SSD1306::drawString(int x, int y, const String &text) {
   unsigned char currentByte;
   int charX, charY;
   int currentBitCount;
@@ -218,9 +560,20 @@ void SSD1306::drawString(int x, int y, String text) {
     startX = x - width;
   }
 
-  for (int j=0; j < text.length(); j++) {
+  // Converted from utf8 as we go rather than into a copy
+  lastChar = 0;
+  const char *chars = text.c_str();
+
+  if (myFont) {
+    drawIndexedString(startX, startY, chars);
+    return;
+  }
+
+  for (int j = 0; chars[j]; j++) {
 
-    charCode = text.charAt(j)-0x20;
+    charCode = utf8ascii((byte)chars[j]);
+    if (charCode == 0) continue;
+    charCode -= 0x20;
 
     currentCharWidth = pgm_read_byte(myFontData + CHAR_WIDTH_START_POS + charCode);
     // Jump to font data beginning
@@ -258,6 +611,92 @@ void SSD1306::drawString(int x, int y, String text) {
   }
 }
 
+// What a glyph row outside the glyph reads as, up to a screen width
+static const uint8_t BLANK_ROW[128] PROGMEM = {0};
+
+void SSD1306::drawIndexedString(int x, int y, const char *chars) {
+  int rows = myFont->rows;
+  if (y >= 64 || y + rows <= 0) return;
+  int firstChar = pgm_read_byte(myFontData + FIRST_CHAR_POS);
+  int numberOfChars = pgm_read_byte(myFontData + CHAR_NUM_POS);
+
+  // Every glyph covers the same buffer pages: glyph page p lands shifted in
+  // page page + p and, unless y is page aligned, page + p + 1. >> floors for
+  // y < 0 too
+  int page = y >> 3;
+  uint8_t shift = y & 7;
+  uint8_t down = 8 - shift;
+  int pages = (rows + 7) >> 3;
+  int first = page < 0 ? 0 : page;
+  int last = (y + rows - 1) >> 3;
+  if (last > 7) last = 7;
+
+  // Every color as one expression: (old & ~(bits & clear)) ^ (bits & flip)
+  uint8_t clear = myColor == INVERSE ? 0x00 : 0xFF;
+  uint8_t flip = myColor == BLACK ? 0x00 : 0xFF;
+
+  // Columns changed per page, marked once at the end
+  int changedFrom[8], changedTo[8];
+  for (int target = first; target <= last; target++) changedTo[target] = -1;
+
+  for (; *chars && x < 128; chars++) {
+    int charCode = (byte)*chars;
+    if (charCode >= 128) {
+      charCode = utf8ascii(charCode);
+      if (charCode == 0) continue;
+    } else {
+      lastChar = 0;
+    }
+    charCode -= firstChar;
+    if (charCode < 0 || charCode >= numberOfChars) continue;
+
+    int width = pgm_read_byte(myFontData + CHAR_WIDTH_START_POS + charCode);
+    int from = x < 0 ? -x : 0;
+    int to = x + width > 128 ? 128 - x : width;
+    const uint8_t *columns = myFont->columns + pgm_read_word(myFont->offsets + charCode);
+    const uint8_t *blank = BLANK_ROW - from;
+
+    for (int target = first; from < to && target <= last; target++) {
+      // Each byte ORs the glyph page below shifted down with the one above
+      // shifted up; rows outside the glyph read as blank
+      int p = target - page;
+      const uint8_t *lower = p < pages ? columns + p * width : blank;
+      const uint8_t *upper = p > 0 ? columns + (p - 1) * width : blank;
+      uint8_t *row = buffer + target * 128 + x;
+      uint8_t changed = 0;
+      if (shift) {
+        for (int i = from; i < to; i++) {
+          uint8_t bits = pgm_read_byte(lower + i) << shift | pgm_read_byte(upper + i) >> down;
+          uint8_t old = row[i];
+          uint8_t now = (old & ~(bits & clear)) ^ (bits & flip);
+          row[i] = now;
+          changed |= now ^ old;
+        }
+      } else {
+        for (int i = from; i < to; i++) {
+          uint8_t bits = pgm_read_byte(lower + i);
+          uint8_t old = row[i];
+          uint8_t now = (old & ~(bits & clear)) ^ (bits & flip);
+          row[i] = now;
+          changed |= now ^ old;
+        }
+      }
+      // The glyph's width rather than a branch per byte
+      if (changed) {
+        if (changedTo[target] < 0) changedFrom[target] = x + from;
+        changedTo[target] = x + to - 1;
+      }
+    }
+    x += width;
+  }
+
+  for (int target = first; target <= last; target++) {
+    if (changedTo[target] < 0) continue;
+    markDirty(changedFrom[target], target);
+    markDirty(changedTo[target], target);
+  }
+}
+
 void SSD1306::drawStringMaxWidth(int x, int y, int maxLineWidth, String text) {
   int currentLineWidth = 0;
   int startsAt = 0;
@@ -284,12 +723,16 @@ void SSD1306::drawStringMaxWidth(int x, int y, int maxLineWidth, String text) {
   drawString(x, y + lineNumber * lineHeight, text.substring(startsAt));
 }
 
-int SSD1306::getStringWidth(String text) {
-  text = utf8ascii(text);
+int SSD1306::getStringWidth(const String &text) {
+  int firstChar = myFont ? pgm_read_byte(myFontData + FIRST_CHAR_POS) : 0x20;
   int stringWidth = 0;
-  char charCode;
-  for (int j=0; j < text.length(); j++) {
-    charCode = text.charAt(j)-0x20;
+  int charCode;
+  lastChar = 0;
+  for (const char *c = text.c_str(); *c; c++) {
+    charCode = utf8ascii((byte)*c);
+    if (charCode == 0) continue;
+    charCode -= firstChar;
+    if (myFont && (charCode < 0 || charCode >= pgm_read_byte(myFontData + CHAR_NUM_POS))) continue;
     stringWidth += pgm_read_byte(myFontData + CHAR_WIDTH_START_POS + charCode);
   }
   return stringWidth;
@@ -301,17 +744,23 @@ void SSD1306::setTextAlignment(int textAlignment) {
 
 void SSD1306::setFont(const char *fontData) {
   myFontData = fontData;
+  myFont = NULL;
+}
+
+void SSD1306::setFont(const SSD1306Font &font) {
+  myFontData = font.data;
+  myFont = &font;
 }
 
 void SSD1306::drawBitmap(int x, int y, int width, int height, const char *bitmap) {
-  for (int i = 0; i < width * height / 8; i++ ){
-    unsigned char charColumn = 255 - pgm_read_byte(bitmap + i);
-    for (int j = 0; j < 8; j++) {
-      int targetX = i % width + x;
-      int targetY = (i / (width)) * 8 + j + y;
-      if (bitRead(charColumn, j)) {
-        setPixel(targetX, targetY);
-      }
+  // Already in pages of column bytes, lit bits clear
+  int count = width * height / 8;
+  for (int i = 0, top = y; i < count; top += 8) {
+    for (int column = 0; column < width && i < count; column++, i++) {
+      int targetX = x + column;
+      if (targetX < 0 || targetX >= 128) continue;
+      uint8_t bits = ~pgm_read_byte(bitmap + i);
+      if (bits) drawColumn(targetX, top, bits);
     }
   }
 }
@@ -321,35 +770,51 @@ void SSD1306::setColor(int color) {
 }
 
 void SSD1306::drawRect(int x, int y, int width, int height) {
-  for (int i = x; i < x + width; i++) {
-    setPixel(i, y);
-    setPixel(i, y + height);
-  }
-  for (int i = y; i < y + height; i++) {
-    setPixel(x, i);
-    setPixel(x + width, i);
-  }
+  // The bottom right corner stays unset, as it always has
+  fillRect(x, y, width, 1);
+  fillRect(x, y + height, width, 1);
+  fillRect(x, y, 1, height);
+  fillRect(x + width, y, 1, height);
 }
 
 void SSD1306::fillRect(int x, int y, int width, int height) {
-  for (int i = x; i < x + width; i++) {
-    for (int j = y; j < y + height; j++) {
-      setPixel(i, j);
-    }
+  int left = max(x, 0), right = min(x + width, 128);
+  int top = max(y, 0), bottom = min(y + height, 64);
+  if (left >= right || top >= bottom) return;
+  for (int page = top >> 3; page <= (bottom - 1) >> 3; page++) {
+    uint8_t mask = 0xFF;
+    if (top > page * 8) mask &= 0xFF << (top - page * 8);
+    if (bottom < page * 8 + 8) mask &= 0xFF >> (page * 8 + 8 - bottom);
+    fillColumns(left, right, page, mask);
   }
 }
 
 void SSD1306::drawXbm(int x, int y, int width, int height, const char *xbm) {
-  if (width % 8 != 0) {
-    width =  ((width / 8) + 1) * 8;
-  }
-  for (int i = 0; i < width * height / 8; i++ ){
-    unsigned char charColumn = pgm_read_byte(xbm + i);
-    for (int j = 0; j < 8; j++) {
-      int targetX = (i * 8 + j) % width + x;
-      int targetY = (8 * i / (width)) + y;
-      if (bitRead(charColumn, j)) {
-        setPixel(targetX, targetY);
+  // Rows of (width + 7) / 8 bytes, LSB on the left. Each 8x8 block is
+  // turned into 8 column bytes of the buffer in one go
+  int rowBytes = (width + 7) / 8;
+  for (int band = 0; band < height && y + band < 64; band += 8) {
+    if (y + band + 8 <= 0) continue;
+    int rows = min(height - band, 8);
+    const char *block = xbm + band * rowBytes;
+    for (int b = 0; b < rowBytes; b++) {
+      int left = x + b * 8;
+      if (left >= 128) break;
+      if (left + 8 <= 0) continue;
+      uint64_t m = 0;
+      for (int r = 0; r < rows; r++) {
+        m |= (uint64_t) pgm_read_byte(block + r * rowBytes + b) << (r * 8);
+      }
+      if (!m) continue;
+      // Transpose the 8x8 bit matrix: bit 8 * row + column moves to
+      // 8 * column + row
+      uint64_t t;
+      t = 0x0F0F0F0F00000000ULL & (m ^ (m << 28)); m ^= t ^ (t >> 28);
+      t = 0x3333000033330000ULL & (m ^ (m << 14)); m ^= t ^ (t >> 14);
+      t = 0x5500550055005500ULL & (m ^ (m << 7));  m ^= t ^ (t >> 7);
+      for (int column = 0; column < 8; column++, m >>= 8) {
+        int targetX = left + column;
+        if ((uint8_t) m && targetX >= 0 && targetX < 128) drawColumn(targetX, y + band, m);
       }
     }
   }
@@ -370,6 +835,27 @@ void SSD1306::sendCommand(unsigned char com) {
   }
 }
 
+uint8_t SSD1306::sendCommands(const uint8_t *commands, uint8_t count) {
+  if (I2C_io) {
+   Wire.beginTransmission(myI2cAddress);
+   Wire.write(0x00);                          //command stream
+   for (uint8_t i = 0; i < count; i++) {
+     Wire.write(commands[i]);
+   }
+   Wire.endTransmission();
+   return 2 + count;
+  } else {
+   digitalWrite(myCS, HIGH);
+   digitalWrite(myDC, LOW);                     //command mode
+   digitalWrite(myCS, LOW);
+   for (uint8_t i = 0; i < count; i++) {
+     SPI.transfer(commands[i]);
+   }
+   digitalWrite(myCS, HIGH);
+   return count;
+  }
+}
+
 void SSD1306::sendInitCommands(void) {
   sendCommand(DISPLAYOFF);
   sendCommand(NORMALDISPLAY);
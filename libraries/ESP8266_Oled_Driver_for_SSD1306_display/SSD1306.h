@@ -31,6 +31,20 @@ Credits for parts of this code go to Mike Rankin. Thank you so much for sharing!
 #include <SPI.h>
 #include "SSD1306Fonts.h"
 
+// A font of SSD1306Fonts.h in the layout of the display buffer: glyph c is
+// (rows + 7) / 8 pages of one byte per column, LSB at the top, from
+// columns + offsets[c - first char]. rows is the font height unless a glyph
+// spills past it. First char and widths still come from data. Generated
+// into SSD1306FontIndex.h by tools/ssd1306_font_index.py as <font>_Font.
+struct SSD1306Font {
+  const char *data;
+  uint8_t rows;
+  const uint16_t *offsets;
+  const uint8_t *columns;
+};
+
+#include "SSD1306FontIndex.h"
+
 #define BLACK 0
 #define WHITE 1
 #define INVERSE 2
@@ -85,10 +99,80 @@ private:
    int  myDC, myRST, myCS;
    
    uint8_t buffer[128 * 64 / 8];
+
+   // Columns changed per page since the last display(); clean if from > to
+   uint8_t myDirtyFrom[8];
+   uint8_t myDirtyTo[8];
+
+   // What the last display() cost
+   uint16_t myLastFlushBytes = 0;
+   uint32_t myLastFlushMicros = 0;
+
+   // What the panel was last sent, to skip columns that were redrawn the
+   // same; NULL without setFrameDiff(). Not valid after invalidate() until
+   // the next display()
+   uint8_t *myShown = NULL;
+   bool myShownValid = false;
+
+   // Asynchronous flush: display() copies the changed windows to myTx and
+   // service() sends up to myFlushBudget bus bytes of them per call. NULL
+   // while display() blocks
+   uint8_t *myTx = NULL;
+   uint16_t myFlushBudget = 0;
+   uint8_t myTxWindows[8][4];
+   uint8_t myTxWindowCount = 0;
+   uint8_t myTxWindow = 0;
+   uint16_t myTxPos = 0;
+   uint16_t myTxWindowSent = 0;
+   bool myTxCommanded = false;
+   bool myTxBusy = false;
+   // display() was called while a frame was on the way: the buffer as it
+   // was then, and the columns changed since the frame on the way
+   bool myTxPending = false;
+   uint8_t *myNext = NULL;
+   uint8_t myNextFrom[8];
+   uint8_t myNextTo[8];
+   uint16_t myTxBytes = 0;
+   uint32_t myTxMicros = 0;
+   uint32_t myMaxServiceMicros = 0;
+
    int myTextAlignment = TEXT_ALIGN_LEFT;
    int myColor = WHITE;
    byte lastChar;
    const char *myFontData = ArialMT_Plain_10;
+   // Paged glyphs of myFontData, null for a font set without them
+   const SSD1306Font *myFont = &ArialMT_Plain_10_Font;
+
+   // Note that x of page changed
+   void markDirty(int x, int page);
+
+   // Group the changed columns of frame into windows {from, to, first
+   // page, last page} and mark them clean. Returns how many
+   uint8_t planWindows(uint8_t windows[8][4], const uint8_t *frame, uint8_t *dirtyFrom, uint8_t *dirtyTo);
+
+   // Send the columns from..to of pages first..last in one window
+   void sendWindow(uint8_t from, uint8_t to, uint8_t first, uint8_t last);
+
+   // Copy the changed columns to myNext for after the frame on the way
+   void queue(void);
+
+   // Copy the changed windows (of myNext if queued) to myTx for service()
+   void snapshot(void);
+
+   // Send data bytes in one transfer; returns the bytes on the bus
+   uint8_t sendData(const uint8_t *data, uint8_t count);
+
+   // Draw the 8 pixels of bits, LSB at the top, in column x from row y
+   void drawColumn(int x, int y, uint8_t bits);
+
+   // Apply the color to the mask bits of columns from..to-1 of page
+   void fillColumns(int from, int to, int page, uint8_t mask);
+
+   // drawString() for a font with paged glyphs, left aligned at x, y
+   void drawIndexedString(int x, int y, const char *chars);
+
+   // Send several commands in one transfer; returns the bytes on the bus
+   uint8_t sendCommands(const uint8_t *commands, uint8_t count);
 
 public:
    // Create the display object connected to I2C pins pin sda and sdc
@@ -115,9 +199,45 @@ public:
    // Clear the local pixel buffer
    void clear(void);
 
-   // Write the buffer to the display memory
+   // Write the changed parts of the buffer to the display memory. Drawing
+   // marks the columns it changes in each page; only those windows are sent
    void display(void);
 
+   // Mark the whole buffer changed, so the next display() sends all of it
+   void invalidate(void);
+
+   // Bytes on the bus (I2C including the address bytes) and microseconds
+   // taken by the last display(); with a flush budget, by the last frame
+   // service() finished
+   uint16_t getLastFlushBytes(void);
+   uint32_t getLastFlushMicros(void);
+
+   // Keep a copy of what was sent (1 KB, allocated here) and have
+   // display() send only the columns that differ from it. Drawing code that
+   // clears and redraws everything each frame then costs what actually
+   // changed. Returns false if the copy can't be allocated
+   bool setFrameDiff(bool enabled);
+
+   // Flush without blocking: display() copies the changed windows aside
+   // (two 1 KB buffers, allocated here) and returns at once, and service(),
+   // called from loop(), sends at most bytesPerService bytes of them per
+   // call, but at least one transfer (18 bytes on I2C). Drawing can go on
+   // meanwhile; a display() while a frame is on the way is copied aside as
+   // well and sent after it.
+   // 0 finishes the frame on the way and goes back to a blocking display().
+   // Returns false if the buffer can't be allocated
+   bool setFlushBudget(uint16_t bytesPerService);
+   uint16_t getFlushBudget(void);
+
+   // Send the next part of the frame. Returns true when this call finished it
+   bool service(void);
+
+   // A frame is on the way or waiting to go
+   bool isFlushing(void);
+
+   // The longest service() since the last call, in microseconds
+   uint32_t getMaxServiceMicros(void);
+
    // Set display contrast
    void setContrast(char contrast);
 
@@ -159,8 +279,9 @@ public:
    // taken from http://playground.arduino.cc/Main/Utf8ascii
    String utf8ascii(String s);
 
-   // Draws a string at the given location
-   void drawString(int x, int y, String text);
+   // Draws a string at the given location. Fonts set with their
+   // SSD1306Font are copied a byte per glyph column and page
+   void drawString(int x, int y, const String &text);
 
    // Draws a String with a maximum width at the given location.
    // If the given String is wider than the specified width
@@ -169,7 +290,7 @@ public:
 
    // Returns the width of the String with the current
    // font settings
-   int getStringWidth(String text);
+   int getStringWidth(const String &text);
 
    // Specifies relative to which anchor point
    // the text is rendered. Available constants:
@@ -179,6 +300,11 @@ public:
    // Sets the current font. Available default fonts
    // defined in SSD1306Fonts.h:
    // ArialMT_Plain_10, ArialMT_Plain_16, ArialMT_Plain_24
+   // A font array alone is drawn a pixel at a time
    void setFont(const char *fontData);
 
+   // Sets a font with its paged glyphs, e.g. ArialMT_Plain_16_Font from
+   // SSD1306FontIndex.h, drawn a byte at a time
+   void setFont(const SSD1306Font &font);
+
 };
\ No newline at end of file
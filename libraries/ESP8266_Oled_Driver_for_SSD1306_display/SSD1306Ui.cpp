@@ -7,14 +7,17 @@ SSD1306Ui::SSD1306Ui(SSD1306 *display) {
 
 void SSD1306Ui::init() {
   this->display->init();
+  // Every frame is cleared and redrawn; only what changed goes out
+  this->display->setFrameDiff(true);
 }
 
 void SSD1306Ui::setTargetFPS(byte fps){
   int oldInterval = this->updateInterval;
   this->updateInterval = ((float) 1.0 / (float) fps) * 1000;
+  this->frameInterval = this->updateInterval;
 
   // Calculate new ticksPerFrame
-  float changeRatio = oldInterval / this->updateInterval;
+  float changeRatio = (float) oldInterval / this->updateInterval;
   this->ticksPerFrame *= changeRatio;
   this->ticksPerTransition *= changeRatio;
 }
@@ -88,27 +91,55 @@ void SSD1306Ui::previousFrame() {
 }
 
 
+void SSD1306Ui::setFrameBudget(byte percent) {
+  this->frameShare = constrain(percent, 1, 100);
+}
+
+
 // -/----- State information -----\-
 SSD1306UiState SSD1306Ui::getUiState(){
   return this->state;
 }
 
+const SSD1306UiStats& SSD1306Ui::getStats(){
+  return this->stats;
+}
+
+float SSD1306Ui::getFPS(){
+  unsigned long elapsed = millis() - this->stats.since;
+  return elapsed ? this->stats.frames * 1000.0 / elapsed : 0;
+}
+
+void SSD1306Ui::resetStats(){
+  this->stats = SSD1306UiStats();
+  this->stats.since = millis();
+}
+
 
 int SSD1306Ui::update(){
-  int timeBudget = this->updateInterval - (millis() - this->state.lastUpdate);
-  if ( timeBudget <= 0) {
-    // Implement frame skipping to ensure time budget is keept
-    if (this->autoTransition && this->state.lastUpdate != 0) this->state.ticksSinceLastStateSwitch += ceil(-timeBudget / this->updateInterval);
+  // A frame sent without blocking goes out a part per call
+  if (this->display->service()) this->stats.bytes += this->display->getLastFlushBytes();
 
-    this->state.lastUpdate = millis();
-    this->tick();
+  unsigned long now = millis();
+  int timeBudget = this->frameInterval - (now - this->state.lastUpdate);
+  if ( timeBudget <= 0) {
+    // The animation follows the clock: the ticks a late frame missed are
+    // skipped rather than played slower
+    int ticks = 1;
+    if (this->state.lastUpdate != 0) {
+      ticks = max((now - this->tickTime) / this->updateInterval, 1UL);
+      this->stats.dropped += ticks - 1;
+    }
+    this->tickTime = this->state.lastUpdate != 0 ? this->tickTime + ticks * this->updateInterval : now;
+    this->state.lastUpdate = now;
+    this->tick(ticks);
   }
   return timeBudget;
 }
 
 
-void SSD1306Ui::tick() {
-  this->state.ticksSinceLastStateSwitch++;
+void SSD1306Ui::tick(int ticks) {
+  this->state.ticksSinceLastStateSwitch += ticks;
 
   switch (this->state.frameState) {
     case IN_TRANSITION:
@@ -131,15 +162,37 @@ void SSD1306Ui::tick() {
   }
 
   if (this->dirty) {
-    this->dirty = false;
-    this->display->clear();
-    this->drawIndicator();
-    this->drawFrame();
-    this->drawOverlays();
-    this->display->display();
+    if (this->display->isFlushing()) {
+      // Still sending the last frame: drop this one rather than wait
+      this->stats.dropped++;
+    } else {
+      this->render();
+    }
   }
 }
 
+void SSD1306Ui::render() {
+  unsigned long start = micros();
+  this->dirty = false;
+  this->display->clear();
+  this->drawIndicator();
+  this->drawFrame();
+  this->drawOverlays();
+  this->display->display();
+  unsigned long took = micros() - start;
+
+  // With a flush budget the bytes are counted once update() has sent them
+  if (this->display->getFlushBudget() == 0) this->stats.bytes += this->display->getLastFlushBytes();
+  this->stats.frames++;
+  this->stats.micros += took;
+  byte bucket = 0;
+  for (unsigned long ms = took / 1000; ms && bucket < SSD1306UI_HISTOGRAM_BUCKETS - 1; ms >>= 1) bucket++;
+  this->stats.histogram[bucket]++;
+
+  // Keep frames to frameShare percent of the time
+  this->frameInterval = max(took / 10 / this->frameShare, (unsigned long) this->updateInterval);
+}
+
 void SSD1306Ui::drawFrame(){
   switch (this->state.frameState){
      case IN_TRANSITION: {
@@ -70,6 +70,20 @@ struct SSD1306UiState {
   int           currentFrame              = 0;
 };
 
+#define SSD1306UI_HISTOGRAM_BUCKETS 8
+
+// Frames since the last resetStats()
+struct SSD1306UiStats {
+  unsigned long frames                    = 0;  // rendered
+  unsigned long dropped                   = 0;  // animation steps skipped to keep time
+  unsigned long bytes                     = 0;  // sent on the bus for them
+  unsigned long micros                    = 0;  // spent rendering and sending them
+  unsigned long since                     = 0;  // millis() at resetStats()
+
+  // Frames by render and send time: < 1, < 2, < 4 ... < 64 ms, >= 64 ms
+  unsigned long histogram[SSD1306UI_HISTOGRAM_BUCKETS] = {0};
+};
+
 typedef bool (*FrameCallback)(SSD1306 *display,  SSD1306UiState* state, int x, int y);
 typedef bool (*OverlayCallback)(SSD1306 *display,  SSD1306UiState* state);
 
@@ -110,11 +124,22 @@ class SSD1306Ui {
     // Bookeeping for update
     int                 updateInterval            = 33;
 
+    // Time of the last tick counted; ticks follow millis() from here
+    unsigned long       tickTime                  = 0;
+
+    // Frames are at least updateInterval apart, more when they take more
+    // than frameShare percent of it
+    unsigned long       frameInterval             = 33;
+    byte                frameShare                = 50;
+
+    SSD1306UiStats      stats;
+
     int                 getNextFrameNumber();
     void                drawIndicator();
     void                drawFrame();
     void                drawOverlays();
-    void                tick();
+    void                tick(int ticks);
+    void                render();
 
   public:
 
@@ -201,9 +226,34 @@ class SSD1306Ui {
     void  nextFrame();
     void  previousFrame();
 
+    /**
+     * Set the share of the time, in percent, rendering and sending frames
+     * may take (default 50). When a frame takes longer, the next one
+     * waits; transitions skip the steps in between rather than slow down.
+     */
+    void setFrameBudget(byte percent);
+
     // State Info
     SSD1306UiState getUiState();
 
+    /**
+     * Frames rendered and dropped, bytes sent and frame times since the
+     * last resetStats()
+     */
+    const SSD1306UiStats& getStats();
+
+    /**
+     * Frames rendered per second since the last resetStats()
+     */
+    float getFPS();
+
+    void resetStats();
+
+    /**
+     * Call from loop(). Advances the animation by the ticks elapsed and
+     * renders a frame if one is due and the display isn't still sending
+     * the last one. Returns the milliseconds until the next frame is due
+     */
     int update();
 };
 
@@ -0,0 +1,121 @@
+#include "SSD1306Widgets.h"
+
+
+SSD1306Widget::SSD1306Widget(int x, int y, int width, int height) {
+  this->x = x;
+  this->y = y;
+  this->width = width;
+  this->height = height;
+}
+
+bool SSD1306Widget::isDirty() {
+  return this->dirty;
+}
+
+void SSD1306Widget::invalidate() {
+  this->dirty = true;
+}
+
+void SSD1306Widget::render(SSD1306 *display) {
+  display->setColor(BLACK);
+  display->fillRect(this->x, this->y, this->width, this->height);
+  display->setColor(WHITE);
+  this->draw(display);
+  this->dirty = false;
+}
+
+
+SSD1306ValueWidget::SSD1306ValueWidget(int x, int y, int width, int height, const SSD1306Font &font, const char *suffix)
+  : SSD1306Widget(x, y, width, height) {
+  this->font = &font;
+  this->suffix = suffix;
+}
+
+bool SSD1306ValueWidget::set(long value) {
+  if (this->hasValue && value == this->value) return false;
+  this->value = value;
+  this->hasValue = true;
+  this->dirty = true;
+  return true;
+}
+
+long SSD1306ValueWidget::get() {
+  return this->value;
+}
+
+void SSD1306ValueWidget::draw(SSD1306 *display) {
+  if (!this->hasValue) return;
+  char text[24];
+  snprintf(text, sizeof(text), "%ld%s", this->value, this->suffix);
+  display->setFont(*this->font);
+  display->setTextAlignment(TEXT_ALIGN_LEFT);
+  display->drawString(this->x, this->y, text);
+}
+
+
+SSD1306IconWidget::SSD1306IconWidget(int x, int y, int width, int height, const char * const *icons, uint8_t iconCount)
+  : SSD1306Widget(x, y, width, height) {
+  this->icons = icons;
+  this->iconCount = iconCount;
+}
+
+bool SSD1306IconWidget::set(uint8_t icon) {
+  if (icon >= this->iconCount || icon == this->icon) return false;
+  this->icon = icon;
+  this->dirty = true;
+  return true;
+}
+
+uint8_t SSD1306IconWidget::get() {
+  return this->icon;
+}
+
+void SSD1306IconWidget::draw(SSD1306 *display) {
+  if (this->icons[this->icon] == NULL) return;
+  display->drawXbm(this->x, this->y, this->width, this->height, this->icons[this->icon]);
+}
+
+
+SSD1306Screen::SSD1306Screen(SSD1306 *display) {
+  this->display = display;
+}
+
+bool SSD1306Screen::add(SSD1306Widget *widget) {
+  if (this->widgetCount >= SSD1306_MAX_WIDGETS) return false;
+  this->widgets[this->widgetCount++] = widget;
+  return true;
+}
+
+void SSD1306Screen::setTargetFPS(byte fps) {
+  this->updateInterval = 1000 / (fps ? fps : 1);
+}
+
+void SSD1306Screen::invalidate() {
+  for (uint8_t i = 0; i < this->widgetCount; i++) {
+    this->widgets[i]->invalidate();
+  }
+}
+
+bool SSD1306Screen::update() {
+  if (this->rendered && millis() - this->lastFrame < this->updateInterval) return false;
+
+  bool dirty = false;
+  for (uint8_t i = 0; i < this->widgetCount; i++) {
+    if (this->widgets[i]->isDirty()) {
+      this->widgets[i]->render(this->display);
+      dirty = true;
+    }
+  }
+  if (!dirty) return false;
+
+  // Sends only the columns the widgets changed
+  this->display->display();
+  this->lastFrame = millis();
+  this->rendered = true;
+  this->frames++;
+  return true;
+}
+
+unsigned long SSD1306Screen::getFrames() {
+  return this->frames;
+}
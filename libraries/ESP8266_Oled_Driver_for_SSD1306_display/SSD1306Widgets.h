@@ -0,0 +1,119 @@
+#pragma once
+
+#include <Arduino.h>
+#include "SSD1306.h"
+
+#define SSD1306_MAX_WIDGETS 8
+
+// A rectangle of the screen drawn from state it keeps. Setters mark it
+// dirty only when the state actually changes; SSD1306Screen redraws the
+// dirty widgets at most once per frame.
+class SSD1306Widget {
+  public:
+    SSD1306Widget(int x, int y, int width, int height);
+    virtual ~SSD1306Widget() {}
+
+    bool isDirty();
+
+    /**
+     * Redraw on the next frame even if nothing changed
+     */
+    void invalidate();
+
+    /**
+     * Clear the rectangle and draw the widget into the buffer
+     */
+    void render(SSD1306 *display);
+
+  protected:
+    int   x;
+    int   y;
+    int   width;
+    int   height;
+    bool  dirty = true;
+
+    virtual void draw(SSD1306 *display) = 0;
+};
+
+// A number and a unit, e.g. "1234 W". Blank until the first set().
+class SSD1306ValueWidget : public SSD1306Widget {
+  public:
+    SSD1306ValueWidget(int x, int y, int width, int height, const SSD1306Font &font, const char *suffix);
+
+    /**
+     * Returns true if the value changed
+     */
+    bool set(long value);
+    long get();
+
+  private:
+    const SSD1306Font *font;
+    const char        *suffix;
+    long              value     = 0;
+    bool              hasValue  = false;
+
+    void draw(SSD1306 *display);
+};
+
+// One of a set of XBM images of the widget's size; a NULL entry draws nothing.
+class SSD1306IconWidget : public SSD1306Widget {
+  public:
+    SSD1306IconWidget(int x, int y, int width, int height, const char * const *icons, uint8_t iconCount);
+
+    /**
+     * Returns true if the icon changed
+     */
+    bool set(uint8_t icon);
+    uint8_t get();
+
+  private:
+    const char * const *icons;
+    uint8_t            iconCount;
+    uint8_t            icon       = 0;
+
+    void draw(SSD1306 *display);
+};
+
+// Renders the dirty widgets and sends them with one display() per frame,
+// and only when something changed: however often values are set, the
+// display costs at most one partial flush per frame interval.
+class SSD1306Screen {
+  public:
+    SSD1306Screen(SSD1306 *display);
+
+    /**
+     * Add a widget; up to SSD1306_MAX_WIDGETS
+     */
+    bool add(SSD1306Widget *widget);
+
+    /**
+     * Configure the most frames per second rendered
+     */
+    void setTargetFPS(byte fps);
+
+    /**
+     * Redraw every widget on the next frame, e.g. after something else
+     * used the display
+     */
+    void invalidate();
+
+    /**
+     * Render and display() if a widget is dirty and a frame interval has
+     * passed since the last frame. Returns true if it did
+     */
+    bool update();
+
+    // Frames rendered so far
+    unsigned long getFrames();
+
+  private:
+    SSD1306       *display;
+    SSD1306Widget *widgets[SSD1306_MAX_WIDGETS];
+    uint8_t       widgetCount     = 0;
+
+    unsigned long updateInterval  = 33;
+    unsigned long lastFrame       = 0;
+    bool          rendered        = false;
+
+    unsigned long frames          = 0;
+};
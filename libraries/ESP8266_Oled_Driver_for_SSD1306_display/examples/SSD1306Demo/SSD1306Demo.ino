@@ -110,7 +110,7 @@ void loop() {
 
 bool msOverlay(SSD1306 *display, SSD1306UiState* state) {
   display->setTextAlignment(TEXT_ALIGN_RIGHT);
-  display->setFont(ArialMT_Plain_10);
+  display->setFont(ArialMT_Plain_10_Font);
   display->drawString(128, 0, String(millis()));
   return true;
 }
@@ -130,13 +130,13 @@ bool drawFrame2(SSD1306 *display, SSD1306UiState* state, int x, int y) {
   // Demonstrates the 3 included default sizes. The fonts come from SSD1306Fonts.h file
   // Besides the default fonts there will be a program to convert TrueType fonts into this format
   display->setTextAlignment(TEXT_ALIGN_LEFT);
-  display->setFont(ArialMT_Plain_10);
+  display->setFont(ArialMT_Plain_10_Font);
   display->drawString(0 + x, 10 + y, "Arial 10");
 
-  display->setFont(ArialMT_Plain_16);
+  display->setFont(ArialMT_Plain_16_Font);
   display->drawString(0 + x, 20 + y, "Arial 16");
 
-  display->setFont(ArialMT_Plain_24);
+  display->setFont(ArialMT_Plain_24_Font);
   display->drawString(0 + x, 34 + y, "Arial 24");
 
   return false;
@@ -144,7 +144,7 @@ bool drawFrame2(SSD1306 *display, SSD1306UiState* state, int x, int y) {
 
 bool drawFrame3(SSD1306 *display, SSD1306UiState* state, int x, int y) {
   // Text alignment demo
-  display->setFont(ArialMT_Plain_10);
+  display->setFont(ArialMT_Plain_10_Font);
 
   // The coordinates define the left starting point of the text
   display->setTextAlignment(TEXT_ALIGN_LEFT);
@@ -165,7 +165,7 @@ bool drawFrame4(SSD1306 *display, SSD1306UiState* state, int x, int y) {
   // with the third parameter you can define the width after which words will be wrapped.
   // Currently only spaces and "-" are allowed for wrapping
   display->setTextAlignment(TEXT_ALIGN_LEFT);
-  display->setFont(ArialMT_Plain_10);
+  display->setFont(ArialMT_Plain_10_Font);
   display->drawStringMaxWidth(0 + x, 10 + y, 128, "Lorem ipsum dolor sit amet, consetetur sadipscing elitr, sed diam nonumy eirmod tempor invidunt ut labore.");
   return false;
 }
@@ -0,0 +1,271 @@
+#include "ApplianceDetector.h"
+#include <stdlib.h>
+
+// Centroids move by 1/weight of the error; capping the weight keeps them
+// able to follow slow drift (element ageing, line voltage).
+#define APPLIANCE_MAX_WEIGHT 32
+#define APPLIANCE_SEED_WEIGHT 8
+
+// 1 Wh expressed in W*ms.
+static const uint32_t WH_IN_WATT_MILLIS = 3600000UL;
+
+ApplianceDetector::ApplianceDetector(Handler handler)
+    : _handler(handler), _count(0), _started(false), _level(0),
+      _candidate(0), _candidateMs(0), _candidatePulses(0) {
+    for (uint8_t i = 0; i < APPLIANCE_MAX_CANDIDATES; i++) _candidates[i].seen = 0;
+}
+
+int8_t ApplianceDetector::addSignature(const char* name, uint32_t watts) {
+    if (_count >= APPLIANCE_MAX_SIGNATURES) return -1;
+    Signature& s = _sigs[_count];
+    s.name = name;
+    s.watts = watts;
+    s.weight = APPLIANCE_SEED_WEIGHT;
+    s.active = false;
+    s.closing = false;
+    s.onMs = 0;
+    s.runs = 0;
+    s.seenMs = 0;
+    return _count++;
+}
+
+void ApplianceDetector::pulse(uint32_t nowMs, uint32_t watts) {
+    if (watts == 0) return;
+    uint32_t startMs = nowMs - WH_IN_WATT_MILLIS / watts;
+    settle(startMs);
+
+    if (!_started) {
+        _level = watts;
+        _started = true;
+        return;
+    }
+
+    int32_t fromLevel = (int32_t)watts - (int32_t)_level;
+    if ((uint32_t)abs(fromLevel) <= noise(_level)) {
+        // Still on the same level: track it slowly, forget any candidate.
+        _level += fromLevel / 4;
+        _candidatePulses = 0;
+        return;
+    }
+
+    if (_candidatePulses > 0 && (uint32_t)abs((int32_t)watts - (int32_t)_candidate) <= noise(_candidate)) {
+        _candidate = (_candidate + watts) / 2;
+        if (++_candidatePulses >= APPLIANCE_CONFIRM_PULSES) {
+            int32_t delta = (int32_t)_candidate - (int32_t)_level;
+            _level = _candidate;
+            _candidatePulses = 0;
+            step(_candidateMs, delta);
+        }
+        return;
+    }
+
+    // New candidate level. Keep the time of the first reading that left the
+    // old level; that interval is the one the step actually happened in.
+    if (_candidatePulses == 0) _candidateMs = startMs;
+    _candidate = watts;
+    _candidatePulses = 1;
+}
+
+uint8_t ApplianceDetector::signatureCount() const {
+    return _count;
+}
+
+const char* ApplianceDetector::signatureName(uint8_t index) const {
+    return _sigs[index].name;
+}
+
+uint32_t ApplianceDetector::signatureWatts(uint8_t index) const {
+    return _sigs[index].watts;
+}
+
+uint32_t ApplianceDetector::signatureRuns(uint8_t index) const {
+    return _sigs[index].runs;
+}
+
+bool ApplianceDetector::signatureActive(uint8_t index) const {
+    return _sigs[index].active;
+}
+
+uint32_t ApplianceDetector::level() const {
+    return _level;
+}
+
+void ApplianceDetector::step(uint32_t atMs, int32_t delta) {
+    uint32_t size = (uint32_t)abs(delta);
+    if (size < APPLIANCE_MIN_STEP_W) return;
+    ApplianceEdge edge = delta > 0 ? APPLIANCE_ON : APPLIANCE_OFF;
+
+    int8_t index = match(size);
+    if (index >= 0) {
+        _sigs[index].seenMs = atMs;
+        learn(index, size);
+        emit(atMs, delta, index, edge);
+        return;
+    }
+
+    // One running appliance handing over to another in the same pulse
+    // interval: delta == on(a) - off(b).
+    for (uint8_t b = 0; b < _count; b++) {
+        if (!_sigs[b].active) continue;
+        for (uint8_t a = 0; a < _count; a++) {
+            if (a == b) continue;
+            int32_t pair = (int32_t)_sigs[a].watts - (int32_t)_sigs[b].watts;
+            if ((uint32_t)abs(pair - delta) <= tolerance(size)) {
+                emit(atMs, -(int32_t)_sigs[b].watts, b, APPLIANCE_OFF);
+                emit(atMs, (int32_t)_sigs[a].watts, a, APPLIANCE_ON);
+                return;
+            }
+        }
+    }
+
+    emit(atMs, delta, candidate(atMs, size), edge);
+}
+
+// Count an unmatched step against the candidates; returns the signature
+// it was learned as, or -1 while it is still a candidate
+int8_t ApplianceDetector::candidate(uint32_t atMs, uint32_t watts) {
+    int8_t slot = -1;
+    uint32_t bestError = 0;
+    for (uint8_t i = 0; i < APPLIANCE_MAX_CANDIDATES; i++) {
+        Candidate& c = _candidates[i];
+        if (!c.seen) continue;
+        uint32_t error = (uint32_t)abs((int32_t)watts - (int32_t)c.watts);
+        if (error <= tolerance(c.watts) && (slot < 0 || error < bestError)) {
+            slot = i;
+            bestError = error;
+        }
+    }
+
+    if (slot < 0) {
+        // A free slot, else the one seen longest ago
+        slot = 0;
+        for (uint8_t i = 0; i < APPLIANCE_MAX_CANDIDATES; i++) {
+            if (!_candidates[i].seen) {
+                slot = i;
+                break;
+            }
+            if (atMs - _candidates[i].seenMs > atMs - _candidates[slot].seenMs) slot = i;
+        }
+        _candidates[slot].watts = watts;
+        _candidates[slot].seen = 1;
+        _candidates[slot].seenMs = atMs;
+        return -1;
+    }
+
+    Candidate& c = _candidates[slot];
+    c.seen++;
+    c.watts += ((int32_t)watts - (int32_t)c.watts) / (int32_t)c.seen;
+    c.seenMs = atMs;
+    if (c.seen < APPLIANCE_LEARN_SEEN) return -1;
+
+    int8_t index = promote(atMs, c.watts, c.seen);
+    if (index >= 0) c.seen = 0;
+    return index;
+}
+
+// Learn a confirmed step size: a free slot, else the learned signature
+// with the lowest weight, the one seen longest ago on a tie. Seeded ones
+// and those in a run stay. Returns -1 if every slot is one of those
+int8_t ApplianceDetector::promote(uint32_t atMs, uint32_t watts, uint8_t seen) {
+    int8_t index = addSignature(nullptr, watts);
+    if (index < 0) {
+        for (uint8_t i = 0; i < _count; i++) {
+            const Signature& s = _sigs[i];
+            if (s.name || s.active || s.closing) continue;
+            if (index < 0 || s.weight < _sigs[index].weight ||
+                (s.weight == _sigs[index].weight && atMs - s.seenMs > atMs - _sigs[index].seenMs)) {
+                index = i;
+            }
+        }
+        if (index < 0) return -1;
+        Signature& s = _sigs[index];
+        s.watts = watts;
+        s.runs = 0;
+        s.onMs = 0;
+    }
+    _sigs[index].weight = seen;
+    _sigs[index].seenMs = atMs;
+    return index;
+}
+
+int8_t ApplianceDetector::match(uint32_t watts) const {
+    int8_t best = -1;
+    uint32_t bestError = 0;
+    for (uint8_t i = 0; i < _count; i++) {
+        uint32_t error = (uint32_t)abs((int32_t)watts - (int32_t)_sigs[i].watts);
+        if (error <= tolerance(_sigs[i].watts) && (best < 0 || error < bestError)) {
+            best = i;
+            bestError = error;
+        }
+    }
+    return best;
+}
+
+void ApplianceDetector::learn(int8_t index, uint32_t watts) {
+    Signature& s = _sigs[index];
+    if (s.weight < APPLIANCE_MAX_WEIGHT) s.weight++;
+    s.watts += ((int32_t)watts - (int32_t)s.watts) / (int32_t)s.weight;
+}
+
+void ApplianceDetector::emit(uint32_t atMs, int32_t delta, int8_t index, ApplianceEdge edge) {
+    if (index < 0) {
+        report(atMs, delta, _level, index, edge, 0);
+        return;
+    }
+
+    Signature& s = _sigs[index];
+    if (edge == APPLIANCE_ON) {
+        bool resumed = s.closing;
+        s.active = true;
+        s.closing = false;
+        if (resumed) return;
+        s.onMs = atMs;
+        report(atMs, delta, _level, index, edge, 0);
+    } else if (s.active) {
+        // Hold the OFF until settle() knows the run is over.
+        s.active = false;
+        s.closing = true;
+        s.offMs = atMs;
+        s.offLevelW = _level;
+        s.offDeltaW = delta;
+    } else {
+        report(atMs, delta, _level, index, edge, 0);
+    }
+}
+
+// End the runs whose appliance has now been off for APPLIANCE_MIN_OFF_MS
+void ApplianceDetector::settle(uint32_t nowMs) {
+    for (uint8_t i = 0; i < _count; i++) {
+        Signature& s = _sigs[i];
+        if (!s.closing || (int32_t)(nowMs - s.offMs) < (int32_t)APPLIANCE_MIN_OFF_MS) continue;
+        s.closing = false;
+        s.runs++;
+        report(s.offMs, s.offDeltaW, s.offLevelW, i, APPLIANCE_OFF, s.offMs - s.onMs);
+    }
+}
+
+void ApplianceDetector::report(uint32_t atMs, int32_t delta, uint32_t levelW, int8_t index,
+                               ApplianceEdge edge, uint32_t runMs) {
+    ApplianceEvent e;
+    e.atMs = atMs;
+    e.deltaW = delta;
+    e.levelW = levelW;
+    e.signature = index;
+    e.name = index >= 0 ? _sigs[index].name : nullptr;
+    e.edge = edge;
+    e.runMs = runMs;
+    e.runWh = index >= 0 ? (uint32_t)((uint64_t)_sigs[index].watts * runMs / WH_IN_WATT_MILLIS) : 0;
+    if (_handler) _handler(e);
+}
+
+uint32_t ApplianceDetector::tolerance(uint32_t watts) {
+    uint32_t t = watts / 8;
+    return t < 50 ? 50 : t;
+}
+
+uint32_t ApplianceDetector::noise(uint32_t watts) {
+    // Consecutive pulses on a steady load agree to a few watts (power.json:
+    // median 3-14 W); allow 1.5% so a 167 W step still stands out at 5 kW.
+    uint32_t t = watts / 64;
+    return t < 30 ? 30 : t;
+}
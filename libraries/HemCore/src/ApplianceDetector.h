@@ -0,0 +1,130 @@
+#ifndef APPLIANCE_DETECTOR_H
+#define APPLIANCE_DETECTOR_H
+
+#include <stdint.h>
+
+#define APPLIANCE_MAX_SIGNATURES 8
+
+// Steps smaller than this are treated as noise and never learned.
+#define APPLIANCE_MIN_STEP_W 100
+
+// Pulses that must agree on a new level before a step is reported.
+#define APPLIANCE_CONFIRM_PULSES 2
+
+// An unmatched step size is only learned as a signature once it has been
+// seen this many times; until then it waits in one of
+// APPLIANCE_MAX_CANDIDATES slots, the least recently seen making way.
+#define APPLIANCE_LEARN_SEEN 3
+#define APPLIANCE_MAX_CANDIDATES 4
+
+// A run only ends once its appliance has stayed off this long; an ON of the
+// same signature before then continues it. Thermostat-switched loads (the
+// space heater bursts 6 s on / 4 s off) would otherwise be split into a run
+// per burst.
+#define APPLIANCE_MIN_OFF_MS 180000UL
+
+enum ApplianceEdge {
+    APPLIANCE_ON,
+    APPLIANCE_OFF
+};
+
+struct ApplianceEvent {
+    uint32_t atMs;          // start of the pulse interval the step fell in
+    int32_t deltaW;         // signed step size
+    uint32_t levelW;        // whole-house level after the step
+    int8_t signature;       // index into the table, -1 if unmatched
+    const char* name;       // signature name, nullptr for learned ones
+    ApplianceEdge edge;
+    uint32_t runMs;         // OFF only: time since the paired ON, 0 if unpaired
+    uint32_t runWh;         // OFF only: centroid * runMs
+};
+
+// Streaming step-change detector and appliance classifier (NILM) for the
+// 1 Wh pulse stream.
+//
+// Each pulse is one reading of the whole-house level. A step is reported
+// once APPLIANCE_CONFIRM_PULSES consecutive readings agree on a new level
+// (the first reading after a step mixes old and new levels and is skipped).
+// |step| is matched against a small signature table; a match nudges that
+// centroid toward the observation. An unmatched step large enough becomes a
+// candidate, and a candidate seen APPLIANCE_LEARN_SEEN times is learned as
+// a new signature, taking the place of the learned (never a seeded) one
+// with the lowest weight, the longest unseen first, when the table is full.
+// A step that matches no single signature but equals one appliance turning
+// on as a running one turns off (water heater upper -> lower element) is
+// reported as an OFF and an ON.
+//
+// ON/OFF events for the same signature are paired into runs. The OFF that
+// ends a run is held back until the appliance has stayed off for
+// APPLIANCE_MIN_OFF_MS (it keeps its own atMs), and ON/OFF pairs inside a
+// run are not reported at all. Memory is fixed: one table entry per
+// signature. Integer only.
+class ApplianceDetector {
+public:
+    typedef void (*Handler)(const ApplianceEvent& event);
+
+    explicit ApplianceDetector(Handler handler);
+
+    // Seed a known appliance. Returns its index or -1 if the table is full.
+    int8_t addSignature(const char* name, uint32_t watts);
+
+    // A real pulse at nowMs measuring watts.
+    void pulse(uint32_t nowMs, uint32_t watts);
+
+    uint8_t signatureCount() const;
+    const char* signatureName(uint8_t index) const;
+    uint32_t signatureWatts(uint8_t index) const;
+    uint32_t signatureRuns(uint8_t index) const;
+    // True while the appliance is on (not while a run is waiting out
+    // APPLIANCE_MIN_OFF_MS).
+    bool signatureActive(uint8_t index) const;
+
+    // Current stable whole-house level (0 until the first pulse).
+    uint32_t level() const;
+
+private:
+    struct Signature {
+        const char* name;
+        uint32_t watts;     // centroid
+        uint16_t weight;    // observations, capped; sets the update rate
+        bool active;
+        bool closing;       // off, run ends at offMs unless it comes back on
+        uint32_t onMs;
+        uint32_t offMs;
+        uint32_t offLevelW;
+        int32_t offDeltaW;
+        uint32_t runs;
+        uint32_t seenMs;
+    };
+
+    struct Candidate {
+        uint32_t watts;
+        uint8_t seen;       // 0: free slot
+        uint32_t seenMs;
+    };
+
+    void step(uint32_t atMs, int32_t delta);
+    int8_t match(uint32_t watts) const;
+    void learn(int8_t index, uint32_t watts);
+    int8_t candidate(uint32_t atMs, uint32_t watts);
+    int8_t promote(uint32_t atMs, uint32_t watts, uint8_t seen);
+    void emit(uint32_t atMs, int32_t delta, int8_t index, ApplianceEdge edge);
+    void settle(uint32_t nowMs);
+    void report(uint32_t atMs, int32_t delta, uint32_t levelW, int8_t index, ApplianceEdge edge,
+                uint32_t runMs);
+    static uint32_t tolerance(uint32_t watts);
+    static uint32_t noise(uint32_t watts);
+
+    Handler _handler;
+    Signature _sigs[APPLIANCE_MAX_SIGNATURES];
+    uint8_t _count;
+    Candidate _candidates[APPLIANCE_MAX_CANDIDATES];
+
+    bool _started;
+    uint32_t _level;
+    uint32_t _candidate;
+    uint32_t _candidateMs;
+    uint8_t _candidatePulses;
+};
+
+#endif
@@ -0,0 +1,60 @@
+#include "EnergyBudget.h"
+
+EnergyBudget::EnergyBudget(uint16_t idleMw, uint16_t radioMw)
+    : _idleMw(idleMw), _radioMw(radioMw), _on(false), _haveHour(false),
+      _onSince(0), _hourStart(0), _hourOnMs(0), _lastHourOnMs(0) {}
+
+void EnergyBudget::radioOn(uint32_t nowMs) {
+    if (_on) return;
+    update(nowMs);
+    _on = true;
+    _onSince = nowMs;
+}
+
+void EnergyBudget::radioOff(uint32_t nowMs) {
+    if (!_on) return;
+    update(nowMs);
+    _hourOnMs += nowMs - _onSince;
+    _on = false;
+}
+
+void EnergyBudget::update(uint32_t nowMs) {
+    while (nowMs - _hourStart >= ENERGY_BUDGET_HOUR_MS) {
+        uint32_t hourEnd = _hourStart + ENERGY_BUDGET_HOUR_MS;
+        if (_on) {
+            // Split an ongoing wake at the hour boundary.
+            _hourOnMs += hourEnd - _onSince;
+            _onSince = hourEnd;
+        }
+        _lastHourOnMs = _hourOnMs;
+        _hourOnMs = 0;
+        _hourStart = hourEnd;
+        _haveHour = true;
+    }
+}
+
+bool EnergyBudget::radioIsOn() const {
+    return _on;
+}
+
+uint32_t EnergyBudget::onMsPerHour(uint32_t nowMs) const {
+    if (_haveHour) return _lastHourOnMs;
+    uint32_t elapsed = nowMs - _hourStart;
+    if (elapsed == 0) return _on ? ENERGY_BUDGET_HOUR_MS : 0;
+    return (uint32_t)((uint64_t)currentOnMs(nowMs) * ENERGY_BUDGET_HOUR_MS / elapsed);
+}
+
+uint32_t EnergyBudget::averageMw(uint32_t nowMs) const {
+    return _idleMw + (uint32_t)((uint64_t)_radioMw * onMsPerHour(nowMs) / ENERGY_BUDGET_HOUR_MS);
+}
+
+uint32_t EnergyBudget::projectedHours(uint32_t nowMs, uint16_t capacityWh, uint8_t percent) const {
+    uint32_t mw = averageMw(nowMs);
+    if (mw == 0) return 0;
+    // capacityWh * 1000 mWh * percent / 100
+    return (uint32_t)capacityWh * 10 * percent / mw;
+}
+
+uint32_t EnergyBudget::currentOnMs(uint32_t nowMs) const {
+    return _hourOnMs + (_on ? nowMs - _onSince : 0);
+}
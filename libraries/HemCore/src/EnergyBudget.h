@@ -0,0 +1,47 @@
+#ifndef ENERGY_BUDGET_H
+#define ENERGY_BUDGET_H
+
+#include <stdint.h>
+
+#define ENERGY_BUDGET_HOUR_MS 3600000UL
+
+// Measures how long the modem is on per hour and projects battery life from
+// it with a two-state power model: idleMw with the modem asleep (CPU, pulse
+// sensor, regulator) and idleMw + radioMw while it is associated.
+//
+// The sketch calls radioOn()/radioOff() around every wake; update() rolls
+// the hour over and should be called from loop().
+class EnergyBudget {
+public:
+    EnergyBudget(uint16_t idleMw, uint16_t radioMw);
+
+    void radioOn(uint32_t nowMs);
+    void radioOff(uint32_t nowMs);
+    void update(uint32_t nowMs);
+
+    bool radioIsOn() const;
+
+    // Modem-on time over the last complete hour; before the first hour is
+    // up, the current hour scaled to a full one.
+    uint32_t onMsPerHour(uint32_t nowMs) const;
+
+    // Average draw in mW at the measured duty cycle.
+    uint32_t averageMw(uint32_t nowMs) const;
+
+    // Hours left on a pack of capacityWh at percent charge.
+    uint32_t projectedHours(uint32_t nowMs, uint16_t capacityWh, uint8_t percent) const;
+
+private:
+    uint32_t currentOnMs(uint32_t nowMs) const;
+
+    uint16_t _idleMw;
+    uint16_t _radioMw;
+    bool _on;
+    bool _haveHour;
+    uint32_t _onSince;
+    uint32_t _hourStart;
+    uint32_t _hourOnMs;
+    uint32_t _lastHourOnMs;
+};
+
+#endif
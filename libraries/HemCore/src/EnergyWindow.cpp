@@ -0,0 +1,78 @@
+#include "EnergyWindow.h"
+
+// 1 mWh expressed in W*ms.
+static const uint32_t MWH_IN_WATT_MILLIS = 3600;
+
+EnergyWindow::EnergyWindow(uint32_t lengthMs, Handler handler)
+    : _length(lengthMs), _handler(handler), _started(false), _start(0),
+      _wattMs(0), _min(UINT32_MAX), _max(0), _pulses(0) {}
+
+void EnergyWindow::pulse(uint32_t nowMs, uint32_t intervalUs, uint32_t watts) {
+    uint32_t fromMs = nowMs - intervalUs / 1000;
+    if (!_started) {
+        // Align windows to multiples of the length so 1 min / 15 min
+        // windows line up with each other.
+        reset(fromMs - fromMs % _length);
+        _started = true;
+    }
+    credit(fromMs, nowMs, watts);
+    _pulses++;
+}
+
+void EnergyWindow::tick(uint32_t nowMs) {
+    if (!_started) return;
+    if ((int32_t)(nowMs - (_start + _length + ENERGY_WINDOW_GRACE_MS)) < 0) return;
+
+    close();
+    // After a long silence skip the empty windows instead of publishing
+    // every one of them.
+    uint32_t behind = nowMs - ENERGY_WINDOW_GRACE_MS - _start;
+    if ((int32_t)behind > (int32_t)_length) {
+        reset(_start + behind - behind % _length);
+    }
+}
+
+uint32_t EnergyWindow::lengthMs() const {
+    return _length;
+}
+
+void EnergyWindow::credit(uint32_t fromMs, uint32_t toMs, uint32_t watts) {
+    if ((int32_t)(fromMs - _start) < 0) fromMs = _start;
+
+    for (;;) {
+        uint32_t end = _start + _length;
+        bool crosses = (int32_t)(toMs - end) > 0;
+        uint32_t until = crosses ? end : toMs;
+
+        if ((int32_t)(until - fromMs) > 0) {
+            _wattMs += (uint64_t)watts * (until - fromMs);
+            if (watts < _min) _min = watts;
+            if (watts > _max) _max = watts;
+        }
+        if (!crosses) return;
+
+        close();
+        fromMs = _start;
+    }
+}
+
+void EnergyWindow::close() {
+    EnergySummary s;
+    s.startMs = _start;
+    s.lengthMs = _length;
+    s.mWh = (uint32_t)(_wattMs / MWH_IN_WATT_MILLIS);
+    s.meanW = (uint32_t)(_wattMs / _length);
+    s.minW = _min == UINT32_MAX ? 0 : _min;
+    s.maxW = _max;
+    s.pulses = _pulses;
+    if (_handler) _handler(s);
+    reset(_start + _length);
+}
+
+void EnergyWindow::reset(uint32_t startMs) {
+    _start = startMs;
+    _wattMs = 0;
+    _min = UINT32_MAX;
+    _max = 0;
+    _pulses = 0;
+}
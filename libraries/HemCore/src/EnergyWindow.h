@@ -0,0 +1,59 @@
+#ifndef ENERGY_WINDOW_H
+#define ENERGY_WINDOW_H
+
+#include <stdint.h>
+
+// A window with no pulse for this long past its end is closed anyway
+// (below ~60 W the meter is effectively idle). Energy of an interval that
+// straddles an already-closed window is only credited to the open part.
+#define ENERGY_WINDOW_GRACE_MS 60000
+
+struct EnergySummary {
+    uint32_t startMs;   // millis() at the start of the window
+    uint32_t lengthMs;
+    uint32_t mWh;       // energy in the window
+    uint32_t meanW;
+    uint32_t minW;      // lowest/highest pulse-interval power overlapping the window
+    uint32_t maxW;
+    uint16_t pulses;    // pulses that ended inside the window
+};
+
+// Fixed-length energy aggregation over the 1 Wh pulse stream.
+//
+// Each pulse closes an interval of known length and power; that interval's
+// energy is split across the windows it overlaps, so a 10 s window at 167 W
+// (one pulse every 21.5 s) still reports ~167 W rather than 0 or 360.
+// A window is handed to the handler when the first pulse past its end
+// arrives, i.e. at most one pulse interval late.
+//
+// Integer only. Work per pulse is constant plus one step per window closed.
+class EnergyWindow {
+public:
+    typedef void (*Handler)(const EnergySummary& summary);
+
+    EnergyWindow(uint32_t lengthMs, Handler handler);
+
+    // A pulse at nowMs that ended an interval of intervalUs at watts.
+    void pulse(uint32_t nowMs, uint32_t intervalUs, uint32_t watts);
+
+    // Close windows that have gone ENERGY_WINDOW_GRACE_MS without a pulse.
+    void tick(uint32_t nowMs);
+
+    uint32_t lengthMs() const;
+
+private:
+    void credit(uint32_t fromMs, uint32_t toMs, uint32_t watts);
+    void close();
+    void reset(uint32_t startMs);
+
+    uint32_t _length;
+    Handler _handler;
+    bool _started;
+    uint32_t _start;
+    uint64_t _wattMs;
+    uint32_t _min;
+    uint32_t _max;
+    uint16_t _pulses;
+};
+
+#endif
@@ -0,0 +1,174 @@
+#include "FastConnect.h"
+
+#if defined(ESP8266)
+#include <ESP8266WiFi.h>
+#endif
+
+FastConnect::FastConnect(const char* ssid, const char* password, const char* hostname)
+    : _ssid(ssid), _password(password), _hostname(hostname),
+      _ledPin(-1), _state(IDLE), _uses(0), _joinStart(0), _lastBlink(0),
+      _usedCache(false), _connectMs(0), _reported(false) {}
+
+void FastConnect::setStatusLed(uint8_t pin) {
+    _ledPin = pin;
+}
+
+void FastConnect::connect() {
+    while (!service()) {
+        delay(20);
+    }
+}
+
+bool FastConnect::service() {
+    unsigned long now = millis();
+
+    if (linkUp()) {
+        if (_state != LINKED) {
+            _usedCache = _state == JOINING_CACHED;
+            if (_ledPin >= 0) digitalWrite(_ledPin, 1);
+            saveCache(_usedCache ? _uses : 0);
+            _connectMs = now - _joinStart;
+            _state = LINKED;
+        }
+        return true;
+    }
+
+    switch (_state) {
+    case IDLE:
+    case LINKED:
+        // Nothing pending, or the AP went away: start a join.
+        _joinStart = now;
+        _lastBlink = now;
+        if (beginCached(_uses)) {
+            _state = JOINING_CACHED;
+        } else {
+            beginScan();
+            _state = JOINING_SCAN;
+        }
+        break;
+    case JOINING_CACHED:
+        if (now - _joinStart > FAST_CONNECT_TIMEOUT_MS) {
+            // AP moved channel, lease changed, etc. Forget it and do it the slow way.
+            invalidate();
+            beginScan();
+            _state = JOINING_SCAN;
+        }
+        break;
+    case JOINING_SCAN:
+        break;
+    }
+
+    if (_ledPin >= 0 && now - _lastBlink >= FAST_CONNECT_BLINK_MS) {
+        _lastBlink = now;
+        digitalWrite(_ledPin, !digitalRead(_ledPin));
+    }
+    return false;
+}
+
+void FastConnect::disconnect() {
+#if defined(ESP8266)
+    WiFi.disconnect();
+#endif
+    _state = IDLE;
+}
+
+bool FastConnect::usedCache() const {
+    return _usedCache;
+}
+
+unsigned long FastConnect::connectMs() const {
+    return _connectMs;
+}
+
+uint32_t FastConnect::crc32(const uint8_t* data, size_t length) {
+    uint32_t crc = 0xFFFFFFFF;
+    while (length--) {
+        crc ^= *data++;
+        for (uint8_t i = 0; i < 8; i++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+        }
+    }
+    return ~crc;
+}
+
+#if defined(ESP8266)
+
+static void prepare(const char* hostname) {
+    // Credentials are compiled in; don't rewrite them to flash on every join.
+    WiFi.persistent(false);
+    WiFi.mode(WIFI_STA);
+    WiFi.hostname(hostname);
+}
+
+bool FastConnect::linkUp() {
+    return WiFi.status() == WL_CONNECTED;
+}
+
+bool FastConnect::beginCached(uint8_t& uses) {
+    Cache cache;
+    if (!loadCache(cache) || cache.uses >= FAST_CONNECT_MAX_REUSE) return false;
+
+    // Targeted join: no scan, no DHCP.
+    prepare(_hostname);
+    WiFi.config(IPAddress(cache.ip), IPAddress(cache.gateway),
+                IPAddress(cache.subnet), IPAddress(cache.dns));
+    WiFi.begin(_ssid, _password, cache.channel, cache.bssid, true);
+    uses = cache.uses + 1;
+    return true;
+}
+
+void FastConnect::beginScan() {
+    prepare(_hostname);
+    WiFi.disconnect();
+    WiFi.config(0u, 0u, 0u); // Back to DHCP
+    WiFi.begin(_ssid, _password);
+}
+
+void FastConnect::invalidate() {
+    uint32_t zero[sizeof(Cache) / 4] = {0};
+    ESP.rtcUserMemoryWrite(FAST_CONNECT_RTC_BLOCK, zero, sizeof(zero));
+}
+
+bool FastConnect::loadCache(Cache& cache) {
+    if (!ESP.rtcUserMemoryRead(FAST_CONNECT_RTC_BLOCK, (uint32_t*)&cache, sizeof(cache))) {
+        return false;
+    }
+    // RTC memory is garbage after a power cycle; the CRC catches that.
+    uint32_t crc = crc32((const uint8_t*)&cache + sizeof(cache.crc), sizeof(cache) - sizeof(cache.crc));
+    return crc == cache.crc && cache.channel > 0 && cache.ip != 0;
+}
+
+void FastConnect::saveCache(uint8_t uses) {
+    Cache cache;
+    memcpy(cache.bssid, WiFi.BSSID(), sizeof(cache.bssid));
+    cache.channel = WiFi.channel();
+    cache.uses = uses;
+    cache.ip = (uint32_t)WiFi.localIP();
+    cache.gateway = (uint32_t)WiFi.gatewayIP();
+    cache.subnet = (uint32_t)WiFi.subnetMask();
+    cache.dns = (uint32_t)WiFi.dnsIP();
+    cache.crc = crc32((const uint8_t*)&cache + sizeof(cache.crc), sizeof(cache) - sizeof(cache.crc));
+    ESP.rtcUserMemoryWrite(FAST_CONNECT_RTC_BLOCK, (uint32_t*)&cache, sizeof(cache));
+}
+
+#else
+
+bool FastConnect::linkUp() {
+    return false;
+}
+
+bool FastConnect::beginCached(uint8_t&) {
+    return false;
+}
+
+void FastConnect::beginScan() {}
+
+void FastConnect::invalidate() {}
+
+bool FastConnect::loadCache(Cache&) {
+    return false;
+}
+
+void FastConnect::saveCache(uint8_t) {}
+
+#endif
@@ -0,0 +1,109 @@
+#ifndef FAST_CONNECT_H
+#define FAST_CONNECT_H
+
+#include <Arduino.h>
+
+// RTC user memory block reserved for the connection cache (see README.md).
+#define FAST_CONNECT_RTC_BLOCK 0
+
+// Give a targeted join this long before falling back to a full scan.
+#define FAST_CONNECT_TIMEOUT_MS 3000
+
+// Reuse a cached lease this many times before doing a normal DHCP join,
+// so the router still sees the node renew its lease now and then.
+#define FAST_CONNECT_MAX_REUSE 16
+
+// Toggle the status LED this often while a join is pending.
+#define FAST_CONNECT_BLINK_MS 200
+
+class FastConnect {
+public:
+    FastConnect(const char* ssid, const char* password, const char* hostname);
+    virtual ~FastConnect() {}
+
+    // Blink this pin while waiting for the AP (same as the old wifiConnect()).
+    void setStatusLed(uint8_t pin);
+
+    // Blocking join, for setup(). service() until associated.
+    void connect();
+
+    // Non-blocking join, for loop(). When the link is down the first call
+    // starts a join (cached BSSID/channel/IP first, like connect()) and the
+    // calls after that only check on it, falling back to a full scan +
+    // DHCP once the targeted join has had FAST_CONNECT_TIMEOUT_MS. WiFi.begin
+    // runs once per join; the SDK keeps retrying on its own. True while
+    // associated.
+    bool service();
+
+    // Drop the link and any pending join, e.g. before forceSleepBegin(). The
+    // next service() starts over.
+    void disconnect();
+
+    // Drop the cached entry so the next join does a full scan.
+    void invalidate();
+
+    // True if the last join used the cached entry.
+    bool usedCache() const;
+
+    // Duration of the last join in milliseconds.
+    unsigned long connectMs() const;
+
+    // Once per boot, after the first MQTT connect: <hostname>/boot/ttfp
+    // (ms from reset to this publish), boot/wifi (connectMs()) and
+    // boot/path ("cached" or "scan"), so the fast-connect path can be
+    // checked from the broker. mqtt is a PubSubClient.
+    template <class Mqtt>
+    void report(Mqtt& mqtt) {
+        if (_reported) return;
+        char topic[32];
+        char buf[16];
+        snprintf(topic, sizeof(topic), "%s/boot/ttfp", _hostname);
+        snprintf(buf, sizeof(buf), "%lu", millis());
+        _reported = mqtt.publish(topic, buf);
+        snprintf(topic, sizeof(topic), "%s/boot/wifi", _hostname);
+        snprintf(buf, sizeof(buf), "%lu", _connectMs);
+        mqtt.publish(topic, buf);
+        snprintf(topic, sizeof(topic), "%s/boot/path", _hostname);
+        mqtt.publish(topic, _usedCache ? "cached" : "scan");
+    }
+
+protected:
+    // The radio. ESP8266WiFi on the ESP8266; tests override them.
+    virtual bool linkUp();
+    // Start a targeted join from the cache. False (and nothing started) if
+    // there is no usable entry; uses is what to save once associated.
+    virtual bool beginCached(uint8_t& uses);
+    virtual void beginScan();
+    virtual void saveCache(uint8_t uses);
+
+private:
+    enum State { IDLE, JOINING_CACHED, JOINING_SCAN, LINKED };
+
+    struct Cache {
+        uint32_t crc;
+        uint8_t bssid[6];
+        uint8_t channel;
+        uint8_t uses;
+        uint32_t ip;
+        uint32_t gateway;
+        uint32_t subnet;
+        uint32_t dns;
+    };
+
+    bool loadCache(Cache& cache);
+    static uint32_t crc32(const uint8_t* data, size_t length);
+
+    const char* _ssid;
+    const char* _password;
+    const char* _hostname;
+    int _ledPin;
+    State _state;
+    uint8_t _uses;
+    unsigned long _joinStart;
+    unsigned long _lastBlink;
+    bool _usedCache;
+    unsigned long _connectMs;
+    bool _reported;
+};
+
+#endif
@@ -0,0 +1,119 @@
+#include "FlowMeter.h"
+
+// milli-GPM = pulses / FLOW_PULSES_PER_GALLON gal / (us / 60e6) min * 1000
+#define MILLI_GPM_US (60000000000ULL / FLOW_PULSES_PER_GALLON)
+
+FlowMeter::FlowMeter(Handler handler)
+    : _handler(handler), _historyCount(0), _historyHead(0), _measured(0),
+      _started(false), _lastMs(0), _lastUs(0), _total(0),
+      _inDraw(false), _drawReported(false), _drawStartMs(0), _drawPulses(0), _drawPeak(0),
+      _leaking(false), _flowingSinceMs(0), _flowingPulses(0) {}
+
+void FlowMeter::pulse(uint32_t nowMs, uint32_t nowUs) {
+    tick(nowMs);
+    _total++;
+
+    if (!_started || nowMs - _lastMs >= FLOW_QUIET_MS) {
+        _flowingSinceMs = nowMs;
+        _flowingPulses = 0;
+    }
+    _flowingPulses++;
+
+    if (!_inDraw) {
+        // Intervals across a gap say nothing about this draw's rate.
+        _inDraw = true;
+        _drawReported = false;
+        _drawStartMs = nowMs;
+        _drawPulses = 0;
+        _drawPeak = 0;
+        _historyCount = 0;
+        _measured = 0;
+    }
+    _drawPulses++;
+
+    _history[_historyHead] = nowUs;
+    _historyHead = (_historyHead + 1) & (FLOW_HISTORY - 1);
+    if (_historyCount < FLOW_HISTORY) _historyCount++;
+
+    if (_historyCount >= 2) {
+        // Widen the window one interval at a time until it spans
+        // FLOW_WINDOW_US or the history runs out.
+        uint8_t intervals = 0;
+        uint32_t span = 0;
+        while (intervals < _historyCount - 1) {
+            intervals++;
+            span = nowUs - _history[(_historyHead - 1 - intervals) & (FLOW_HISTORY - 1)];
+            if (span >= FLOW_WINDOW_US) break;
+        }
+        if (span) {
+            _measured = (uint32_t)(intervals * MILLI_GPM_US / span);
+            if (_measured > _drawPeak) _drawPeak = _measured;
+        }
+    }
+
+    _started = true;
+    _lastMs = nowMs;
+    _lastUs = nowUs;
+
+    if (!_drawReported && _drawPulses >= FLOW_DRAW_MIN_PULSES) {
+        _drawReported = true;
+        emit(FLOW_DRAW_START, _drawStartMs, nowMs - _drawStartMs, _drawPulses, 0);
+    }
+    if (!_leaking && nowMs - _flowingSinceMs >= FLOW_LEAK_MS) {
+        _leaking = true;
+        emit(FLOW_LEAK, _flowingSinceMs, nowMs - _flowingSinceMs, _flowingPulses, 0);
+    }
+}
+
+void FlowMeter::tick(uint32_t nowMs) {
+    if (!_started) return;
+    uint32_t idle = nowMs - _lastMs;
+
+    if (_inDraw && idle >= FLOW_DRAW_GAP_MS) {
+        _inDraw = false;
+        if (_drawReported) {
+            emit(FLOW_DRAW_END, _drawStartMs, _lastMs - _drawStartMs, _drawPulses, _drawPeak);
+        }
+    }
+    if (_leaking && idle >= FLOW_QUIET_MS) {
+        _leaking = false;
+        emit(FLOW_LEAK_CLEAR, _flowingSinceMs, _lastMs - _flowingSinceMs, _flowingPulses, 0);
+    }
+}
+
+uint32_t FlowMeter::milliGpm(uint32_t nowMs, uint32_t nowUs) const {
+    if (!_inDraw || nowMs - _lastMs >= FLOW_DRAW_GAP_MS || _historyCount < 2) return 0;
+
+    // Less than one pulse since the last one caps the rate.
+    uint32_t elapsed = nowUs - _lastUs;
+    if (elapsed == 0) return _measured;
+    uint64_t bound = MILLI_GPM_US / elapsed;
+    return bound < _measured ? (uint32_t)bound : _measured;
+}
+
+bool FlowMeter::drawing() const {
+    return _inDraw && _drawReported;
+}
+
+bool FlowMeter::leaking() const {
+    return _leaking;
+}
+
+uint32_t FlowMeter::totalPulses() const {
+    return _total;
+}
+
+void FlowMeter::setTotalPulses(uint32_t pulses) {
+    _total = pulses;
+}
+
+void FlowMeter::emit(FlowEventKind kind, uint32_t atMs, uint32_t durationMs, uint32_t pulses, uint32_t peak) {
+    if (!_handler) return;
+    FlowEvent e;
+    e.kind = kind;
+    e.atMs = atMs;
+    e.durationMs = durationMs;
+    e.milliGallons = pulses * FLOW_MGAL_PER_PULSE;
+    e.peakMilliGpm = peak;
+    _handler(e);
+}
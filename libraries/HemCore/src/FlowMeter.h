@@ -0,0 +1,100 @@
+#ifndef FLOW_METER_H
+#define FLOW_METER_H
+
+#include <stdint.h>
+
+// 200 pulses per gallon: 5 milligallons per pulse.
+#define FLOW_PULSES_PER_GALLON 200
+#define FLOW_MGAL_PER_PULSE (1000 / FLOW_PULSES_PER_GALLON)
+
+// Pulse timestamps kept for the rate window (power of two).
+#define FLOW_HISTORY 16
+
+// The rate is averaged over the newest pulses until they span this long
+// (or the history runs out); slow flows fall back to a single interval.
+#define FLOW_WINDOW_US 2000000UL
+
+// No pulse for this long ends a draw. A draw is only reported once it has
+// FLOW_DRAW_MIN_PULSES, so a stray pulse is not a draw.
+#define FLOW_DRAW_GAP_MS 30000UL
+#define FLOW_DRAW_MIN_PULSES 3
+
+// A house with nothing leaking goes this long without a single pulse now
+// and then. Water moving without such a gap for FLOW_LEAK_MS is a leak.
+#define FLOW_QUIET_MS 900000UL
+#define FLOW_LEAK_MS 7200000UL
+
+enum FlowEventKind {
+    FLOW_DRAW_START,
+    FLOW_DRAW_END,
+    FLOW_LEAK,
+    FLOW_LEAK_CLEAR
+};
+
+struct FlowEvent {
+    FlowEventKind kind;
+    uint32_t atMs;          // start of the draw / leak
+    uint32_t durationMs;    // END, LEAK, LEAK_CLEAR: time since atMs
+    uint32_t milliGallons;  // volume over durationMs
+    uint32_t peakMilliGpm;  // END only
+};
+
+// Streaming flow engine for the water softener's pulse meter.
+//
+// pulse() takes each pulse's micros() time (for the rate) and millis() time
+// (for draws and leaks, which outlast the micros() wrap). The rate is
+// averaged over an adaptive window so a running toilet (a pulse every few
+// seconds) and a shower (a pulse every 60 ms) both read correctly, and
+// decays between pulses like PowerEstimator's bound so a closed tap reads
+// zero without waiting for a pulse that never comes.
+//
+// Draws (start/end/volume) and leaks (continuous flow) are reported through
+// the handler. The totalizer counts every pulse; the sketch keeps it in RTC
+// memory across resets. Integer only.
+class FlowMeter {
+public:
+    typedef void (*Handler)(const FlowEvent& event);
+
+    explicit FlowMeter(Handler handler);
+
+    void pulse(uint32_t nowMs, uint32_t nowUs);
+
+    // Ends draws and clears leaks while no pulses arrive; call from loop().
+    void tick(uint32_t nowMs);
+
+    // Current flow, 0 outside a draw.
+    uint32_t milliGpm(uint32_t nowMs, uint32_t nowUs) const;
+
+    bool drawing() const;
+    bool leaking() const;
+
+    uint32_t totalPulses() const;
+    void setTotalPulses(uint32_t pulses);
+
+private:
+    void emit(FlowEventKind kind, uint32_t atMs, uint32_t durationMs, uint32_t pulses, uint32_t peak);
+
+    Handler _handler;
+
+    uint32_t _history[FLOW_HISTORY];
+    uint8_t _historyCount;
+    uint8_t _historyHead;
+    uint32_t _measured;
+
+    bool _started;
+    uint32_t _lastMs;
+    uint32_t _lastUs;
+    uint32_t _total;
+
+    bool _inDraw;
+    bool _drawReported;
+    uint32_t _drawStartMs;
+    uint32_t _drawPulses;
+    uint32_t _drawPeak;
+
+    bool _leaking;
+    uint32_t _flowingSinceMs;
+    uint32_t _flowingPulses;
+};
+
+#endif
@@ -0,0 +1,50 @@
+#if defined(ESP8266)
+
+#include "LittleFSSpill.h"
+#include <LittleFS.h>
+
+LittleFSSpill::LittleFSSpill(uint32_t maxBlocks)
+    : _maxBlocks(maxBlocks), _written(0), _read(0) {}
+
+void LittleFSSpill::begin() {
+    LittleFS.remove(LITTLEFS_SPILL_PATH);
+    _written = 0;
+    _read = 0;
+}
+
+bool LittleFSSpill::push(const uint8_t* block) {
+    if (_written - _read >= _maxBlocks) return false;
+    File file = LittleFS.open(LITTLEFS_SPILL_PATH, "a");
+    if (!file) return false;
+    bool ok = file.write(block, TELEMETRY_BLOCK_SIZE) == TELEMETRY_BLOCK_SIZE;
+    file.close();
+    if (ok) _written++;
+    return ok;
+}
+
+bool LittleFSSpill::peek(uint8_t* block) {
+    if (_read == _written) return false;
+    File file = LittleFS.open(LITTLEFS_SPILL_PATH, "r");
+    if (!file) return false;
+    bool ok = file.seek(_read * TELEMETRY_BLOCK_SIZE) &&
+              file.read(block, TELEMETRY_BLOCK_SIZE) == TELEMETRY_BLOCK_SIZE;
+    file.close();
+    return ok;
+}
+
+void LittleFSSpill::drop() {
+    if (_read == _written) return;
+    _read++;
+    if (_read == _written) {
+        // Drained: start the file over instead of letting it grow forever.
+        LittleFS.remove(LITTLEFS_SPILL_PATH);
+        _read = 0;
+        _written = 0;
+    }
+}
+
+uint32_t LittleFSSpill::count() const {
+    return _written - _read;
+}
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef LITTLEFS_SPILL_H
+#define LITTLEFS_SPILL_H
+
+#include "TelemetryStore.h"
+
+#define LITTLEFS_SPILL_PATH "/sf/spill.bin"
+
+// TelemetryStore overflow on LittleFS: blocks are appended to one file and
+// read back from an offset kept in RAM. The file is cleared by begin(), so
+// spilled data does not outlive a reset (timestamps are uptime-based and
+// series ids are per boot). LittleFS must already be mounted.
+class LittleFSSpill : public TelemetrySpill {
+public:
+    // maxBlocks bounds the file (default 256 blocks = 64 KB).
+    explicit LittleFSSpill(uint32_t maxBlocks = 256);
+
+    void begin();
+
+    bool push(const uint8_t* block) override;
+    bool peek(uint8_t* block) override;
+    void drop() override;
+    uint32_t count() const override;
+
+private:
+    uint32_t _maxBlocks;
+    uint32_t _written;
+    uint32_t _read;
+};
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef PCF8574_ON_PORT_H
+#define PCF8574_ON_PORT_H
+
+#include <PCF8574.h>
+#include "PCF8574Port.h"
+
+// The PCF8574 library's pin API (pinMode(), digitalWrite(), interrupts)
+// on top of a PCF8574Port: its bus reads and writes go through the port,
+// so the port's shadow stays in sync and every transaction is counted
+// once. Writes that change nothing stay off the bus.
+//
+// Header only, so HemCore itself builds without the PCF8574 library.
+class PCF8574OnPort : public PCF8574 {
+public:
+    explicit PCF8574OnPort(PCF8574Port& port) : _port(port) {}
+
+    // Start on the port's address.
+    void begin() { PCF8574::begin(_port.address()); }
+
+protected:
+    bool busRead(uint8_t& value) override { return _port.read(value); }
+    void busWrite(uint8_t value) override { _port.write(value); }
+
+private:
+    PCF8574Port& _port;
+};
+
+#endif
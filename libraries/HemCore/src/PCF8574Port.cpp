@@ -0,0 +1,116 @@
+#include "PCF8574Port.h"
+
+#if defined(ESP8266)
+#include <Wire.h>
+#endif
+
+PCF8574Port::PCF8574Port(uint8_t address)
+    : _address(address), _shadow(0xFF), _valid(false), _lastVerifyMs(0),
+      _transactions(0), _errors(0), _mismatches(0) {}
+
+bool PCF8574Port::begin(uint8_t initial) {
+    _valid = false;
+    return send(initial);
+}
+
+bool PCF8574Port::apply(uint8_t mask, uint8_t value) {
+    uint8_t next = (_shadow & ~mask) | (value & mask);
+    if (_valid && next == _shadow) return true;
+    return send(next);
+}
+
+bool PCF8574Port::write(uint8_t value) {
+    return apply(0xFF, value);
+}
+
+bool PCF8574Port::digitalWrite(uint8_t pin, uint8_t value) {
+    uint8_t bit = 1 << pin;
+    return apply(bit, value ? bit : 0);
+}
+
+uint8_t PCF8574Port::shadow() const {
+    return _shadow;
+}
+
+uint8_t PCF8574Port::digitalRead(uint8_t pin) const {
+    return (_shadow >> pin) & 1;
+}
+
+bool PCF8574Port::read(uint8_t& value) {
+    _transactions++;
+    if (!busRead(value)) {
+        _errors++;
+        return false;
+    }
+    return true;
+}
+
+bool PCF8574Port::verify() {
+    uint8_t actual;
+    if (!read(actual)) return false;
+    if (actual == _shadow) return true;
+    _mismatches++;
+    send(_shadow);
+    return false;
+}
+
+bool PCF8574Port::service(uint32_t nowMs) {
+    if (nowMs - _lastVerifyMs < PCF8574_VERIFY_MS) return true;
+    _lastVerifyMs = nowMs;
+    return verify();
+}
+
+uint8_t PCF8574Port::address() const {
+    return _address;
+}
+
+uint32_t PCF8574Port::transactions() const {
+    return _transactions;
+}
+
+uint32_t PCF8574Port::errors() const {
+    return _errors;
+}
+
+uint32_t PCF8574Port::mismatches() const {
+    return _mismatches;
+}
+
+bool PCF8574Port::send(uint8_t value) {
+    _shadow = value;
+    _transactions++;
+    if (!busWrite(value)) {
+        // Leave the shadow as intended; the next write or verify retries.
+        _valid = false;
+        _errors++;
+        return false;
+    }
+    _valid = true;
+    return true;
+}
+
+#if defined(ESP8266)
+
+bool PCF8574Port::busWrite(uint8_t value) {
+    Wire.beginTransmission(_address);
+    Wire.write(value);
+    return Wire.endTransmission() == 0;
+}
+
+bool PCF8574Port::busRead(uint8_t& value) {
+    if (Wire.requestFrom(_address, (uint8_t)1) != 1) return false;
+    value = Wire.read();
+    return true;
+}
+
+#else
+
+bool PCF8574Port::busWrite(uint8_t) {
+    return false;
+}
+
+bool PCF8574Port::busRead(uint8_t&) {
+    return false;
+}
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef PCF8574_PORT_H
+#define PCF8574_PORT_H
+
+#include <stdint.h>
+
+// Read the chip back this often to catch a relay board that reset or
+// glitched behind our back.
+#define PCF8574_VERIFY_MS 60000UL
+
+// PCF8574 output port with a shadow of what was last written.
+//
+// The chip has no register map: one I2C write sets all eight pins, one read
+// returns them. So a whole relay pattern goes out as a single masked write
+// (no read-modify-write, no half-switched states in between), pin reads come
+// from the shadow, and the bus is only read to verify. Every bus transaction
+// is counted.
+//
+// Pins used as inputs must be kept high in the shadow (quasi-bidirectional).
+// PCF8574OnPort.h puts the PCF8574 library's pin API on top of a port so
+// both share one shadow and one counter.
+class PCF8574Port {
+public:
+    explicit PCF8574Port(uint8_t address);
+    virtual ~PCF8574Port() {}
+
+    // Drive all pins to initial in one write.
+    bool begin(uint8_t initial = 0xFF);
+
+    // Set the pins in mask to the matching bits of value in one transaction.
+    // Nothing goes on the bus if the shadow already matches.
+    bool apply(uint8_t mask, uint8_t value);
+    bool write(uint8_t value);
+    bool digitalWrite(uint8_t pin, uint8_t value);
+
+    // From the shadow; no bus traffic.
+    uint8_t shadow() const;
+    uint8_t digitalRead(uint8_t pin) const;
+
+    // Bus read of the pin levels (for input pins).
+    bool read(uint8_t& value);
+
+    // Read the chip back and rewrite the shadow if it differs. False on a
+    // mismatch or bus error.
+    bool verify();
+    // verify() every PCF8574_VERIFY_MS; call from loop(). False only when a
+    // verify ran and failed.
+    bool service(uint32_t nowMs);
+
+    uint8_t address() const;
+    uint32_t transactions() const;
+    uint32_t errors() const;
+    uint32_t mismatches() const;
+
+protected:
+    // One I2C transaction each. Wire on the ESP8266; tests override them.
+    virtual bool busWrite(uint8_t value);
+    virtual bool busRead(uint8_t& value);
+
+private:
+    bool send(uint8_t value);
+
+    uint8_t _address;
+    uint8_t _shadow;
+    bool _valid;
+    uint32_t _lastVerifyMs;
+    uint32_t _transactions;
+    uint32_t _errors;
+    uint32_t _mismatches;
+};
+
+#endif
@@ -0,0 +1,124 @@
+#include "PeriodicityBank.h"
+#include <math.h>
+
+static const float TWO_PI_F = 6.28318530718f;
+
+PeriodicityBank::PeriodicityBank()
+    : _next(0), _samples(0), _sum(0), _binCount(0), _bandCount(0) {
+    for (uint16_t i = 0; i < PERIODICITY_WINDOW; i++) _window[i] = 0;
+}
+
+int8_t PeriodicityBank::addBand(const char* name, float minPeriod, float maxPeriod, uint8_t bins) {
+    if (_bandCount >= PERIODICITY_MAX_BANDS || bins == 0 || _binCount + bins > PERIODICITY_MAX_BINS) {
+        return -1;
+    }
+
+    Band& band = _bands[_bandCount];
+    band.name = name;
+    band.first = _binCount;
+    band.count = bins;
+
+    float fLow = 1.0f / maxPeriod;
+    float fHigh = 1.0f / minPeriod;
+    for (uint8_t i = 0; i < bins; i++) {
+        float f = bins == 1 ? fLow : fLow + (fHigh - fLow) * i / (bins - 1);
+        float w = TWO_PI_F * f;
+
+        Bin& b = _bins[_binCount++];
+        b.period = 1.0f / f;
+        b.rotRe = cosf(w);
+        b.rotIm = sinf(w);
+        b.newRe = cosf(w * (PERIODICITY_WINDOW - 1));
+        b.newIm = -sinf(w * (PERIODICITY_WINDOW - 1));
+        b.dcRe = 0;
+        b.dcIm = 0;
+        for (uint16_t m = 0; m < PERIODICITY_WINDOW; m++) {
+            b.dcRe += cosf(w * m);
+            b.dcIm -= sinf(w * m);
+        }
+        b.re = 0;
+        b.im = 0;
+    }
+
+    // Bring the new bins up to date with whatever is already in the window.
+    resync();
+    return _bandCount++;
+}
+
+void PeriodicityBank::sample(int16_t value) {
+    int16_t old = _window[_next];
+    _window[_next] = value;
+    _next = (_next + 1) % PERIODICITY_WINDOW;
+    _sum += value - old;
+    _samples++;
+
+    for (uint8_t i = 0; i < _binCount; i++) {
+        Bin& b = _bins[i];
+        float re = b.re - old;
+        float im = b.im;
+        b.re = b.rotRe * re - b.rotIm * im + value * b.newRe;
+        b.im = b.rotRe * im + b.rotIm * re + value * b.newIm;
+    }
+
+    if (_samples % PERIODICITY_WINDOW == 0) resync();
+}
+
+bool PeriodicityBank::ready() const {
+    return _samples >= PERIODICITY_WINDOW;
+}
+
+uint8_t PeriodicityBank::bandCount() const {
+    return _bandCount;
+}
+
+const char* PeriodicityBank::bandName(uint8_t band) const {
+    return _bands[band].name;
+}
+
+float PeriodicityBank::dominantPeriod(uint8_t band) const {
+    return _bins[strongest(band)].period;
+}
+
+float PeriodicityBank::amplitude(uint8_t band) const {
+    return binAmplitude(_bins[strongest(band)]);
+}
+
+float PeriodicityBank::binAmplitude(const Bin& b) const {
+    // Take the window mean out so base load does not leak into the bin.
+    float mean = (float)_sum / PERIODICITY_WINDOW;
+    float re = b.re - mean * b.dcRe;
+    float im = b.im - mean * b.dcIm;
+    return 2.0f * sqrtf(re * re + im * im) / PERIODICITY_WINDOW;
+}
+
+uint8_t PeriodicityBank::strongest(uint8_t band) const {
+    const Band& bd = _bands[band];
+    uint8_t best = bd.first;
+    float bestAmp = -1;
+    for (uint8_t i = bd.first; i < bd.first + bd.count; i++) {
+        float a = binAmplitude(_bins[i]);
+        if (a > bestAmp) {
+            bestAmp = a;
+            best = i;
+        }
+    }
+    return best;
+}
+
+void PeriodicityBank::resync() {
+    // Direct DFT over the window, oldest sample first. O(N * bins), run once
+    // per window length.
+    for (uint8_t i = 0; i < _binCount; i++) {
+        Bin& b = _bins[i];
+        float w = TWO_PI_F / b.period;
+        float re = 0, im = 0;
+        for (uint16_t m = 0; m < PERIODICITY_WINDOW; m++) {
+            int16_t x = _window[(_next + m) % PERIODICITY_WINDOW];
+            if (x == 0) continue;
+            re += x * cosf(w * m);
+            im -= x * sinf(w * m);
+        }
+        b.re = re;
+        b.im = im;
+    }
+}
@@ -0,0 +1,79 @@
+#ifndef PERIODICITY_BANK_H
+#define PERIODICITY_BANK_H
+
+#include <stdint.h>
+
+// Samples in the sliding window (one per minute: 8 h, several heater cycles).
+#define PERIODICITY_WINDOW 480
+
+#define PERIODICITY_MAX_BINS 40
+#define PERIODICITY_MAX_BANDS 4
+
+// Sliding single-bin DFTs over the last PERIODICITY_WINDOW samples, grouped
+// into bands around the cycle periods of interest (fridge ~13 min, space
+// heater ~62 min).
+//
+// Each bin is updated in O(1) per sample with the sliding DFT recurrence,
+// which works for arbitrary (non-integer) frequencies:
+//
+//   S(n) = e^{jw} * (S(n-1) - x[n-N]) + x[n] * e^{-jw(N-1)}
+//
+// so bins can sit anywhere, not just at multiples of 1/N. The window
+// mean is removed from each bin when it is read, and every N samples the
+// bins are recomputed from the window to cancel float drift.
+class PeriodicityBank {
+public:
+    PeriodicityBank();
+
+    // Add a band of `bins` bins spread evenly in frequency between the two
+    // periods (in samples). Returns the band index, or -1 if full. Space
+    // them at most 1/(2N) apart (e.g. 24 bins for 11-15 min) or a cycle that
+    // falls between two bins reads low.
+    int8_t addBand(const char* name, float minPeriod, float maxPeriod, uint8_t bins);
+
+    // Push the next sample (e.g. the 1-minute mean power).
+    void sample(int16_t value);
+
+    // True once a full window has been seen.
+    bool ready() const;
+
+    uint8_t bandCount() const;
+    const char* bandName(uint8_t band) const;
+
+    // Period (in samples) of the strongest bin in the band.
+    float dominantPeriod(uint8_t band) const;
+
+    // Amplitude of that bin in input units (a sine of amplitude A reads A).
+    float amplitude(uint8_t band) const;
+
+private:
+    struct Bin {
+        float period;
+        float rotRe, rotIm;     // e^{jw}
+        float newRe, newIm;     // e^{-jw(N-1)}
+        float dcRe, dcIm;       // response to a constant 1
+        float re, im;
+    };
+
+    struct Band {
+        const char* name;
+        uint8_t first;
+        uint8_t count;
+    };
+
+    float binAmplitude(const Bin& b) const;
+    uint8_t strongest(uint8_t band) const;
+    void resync();
+
+    int16_t _window[PERIODICITY_WINDOW];
+    uint16_t _next;
+    uint32_t _samples;
+    int32_t _sum;
+
+    Bin _bins[PERIODICITY_MAX_BINS];
+    uint8_t _binCount;
+    Band _bands[PERIODICITY_MAX_BANDS];
+    uint8_t _bandCount;
+};
+
+#endif
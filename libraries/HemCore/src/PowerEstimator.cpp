@@ -0,0 +1,49 @@
+#include "PowerEstimator.h"
+
+// 1 Wh expressed in W*us.
+static const uint32_t WH_IN_WATT_MICROS = 3600000000UL;
+
+PowerEstimator::PowerEstimator(uint8_t stepMarginPercent)
+    : _margin(stepMarginPercent), _valid(false), _stepReported(false),
+      _lastPulseUs(0), _measured(0) {}
+
+void PowerEstimator::pulse(uint32_t nowUs, uint32_t watts) {
+    _lastPulseUs = nowUs;
+    _measured = watts;
+    _valid = true;
+    _stepReported = false;
+}
+
+bool PowerEstimator::valid() const {
+    return _valid;
+}
+
+uint32_t PowerEstimator::bound(uint32_t nowUs) const {
+    uint32_t elapsed = nowUs - _lastPulseUs;
+    if (elapsed == 0) return WH_IN_WATT_MICROS;
+    return WH_IN_WATT_MICROS / elapsed;
+}
+
+uint32_t PowerEstimator::estimate(uint32_t nowUs) const {
+    if (!_valid) return 0;
+    uint32_t b = bound(nowUs);
+    return b < _measured ? b : _measured;
+}
+
+uint32_t PowerEstimator::measured() const {
+    return _measured;
+}
+
+bool PowerEstimator::checkStepDown(uint32_t nowUs) {
+    if (!_valid || _stepReported) return false;
+    // bound < measured * (100 - margin) / 100, kept in 64 bits to avoid overflow.
+    if ((uint64_t)bound(nowUs) * 100 < (uint64_t)_measured * (100 - _margin)) {
+        _stepReported = true;
+        return true;
+    }
+    return false;
+}
+
+bool PowerEstimator::decaying(uint32_t nowUs) const {
+    return _valid && bound(nowUs) < _measured;
+}
@@ -0,0 +1,53 @@
+#ifndef POWER_ESTIMATOR_H
+#define POWER_ESTIMATOR_H
+
+#include <stdint.h>
+
+// Streaming power estimate between 1 Wh meter pulses.
+//
+// A real pulse gives the exact average power of the interval that just
+// ended. Until the next one arrives, the fact that less than 1 Wh has been
+// used since the last pulse caps the average at 3600 / elapsed_s watts.
+// That cap decays with time, so a load switching off shows up as soon as
+// the cap drops below the last measured value instead of one full (now much
+// longer) pulse interval later.
+//
+// Integer only; timestamps are micros() and may wrap.
+class PowerEstimator {
+public:
+    // stepMarginPercent: how far the bound must fall below the last
+    // measurement before it is called a step-down (absorbs pulse jitter).
+    explicit PowerEstimator(uint8_t stepMarginPercent = 5);
+
+    // Feed a real (already debounced) pulse and its measured power.
+    void pulse(uint32_t nowUs, uint32_t watts);
+
+    // True once at least one pulse has been measured.
+    bool valid() const;
+
+    // Upper bound on the average power since the last pulse.
+    uint32_t bound(uint32_t nowUs) const;
+
+    // Best current estimate: the last measurement, or the bound once it
+    // has decayed below it.
+    uint32_t estimate(uint32_t nowUs) const;
+
+    // Last real measurement.
+    uint32_t measured() const;
+
+    // Returns true exactly once per inter-pulse gap, the first time it is
+    // called with the bound below measured() by more than the margin.
+    bool checkStepDown(uint32_t nowUs);
+
+    // True while the estimate is below the last measurement (i.e. decaying).
+    bool decaying(uint32_t nowUs) const;
+
+private:
+    uint8_t _margin;
+    bool _valid;
+    bool _stepReported;
+    uint32_t _lastPulseUs;
+    uint32_t _measured;
+};
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef POWER_SAVE_H
+#define POWER_SAVE_H
+
+#include "FastConnect.h"
+
+// hem_pwrmtr's power-save mode: the modem sleeps between wakes, and each
+// wake joins (FastConnect), flushes the batch, takes one DS18B20 reading
+// and goes back to sleep. The sketch runs on these numbers and the host
+// simulation in tests/energy_budget_spec.cpp models them, so they live here.
+
+// Wake at least this often, or after a step of POWER_SAVE_WAKE_STEP_W but
+// no sooner than POWER_SAVE_MIN_WAKE_GAP_MS after the last wake.
+#define POWER_SAVE_FLUSH_INTERVAL_MS 300000UL
+#define POWER_SAVE_MIN_WAKE_GAP_MS 60000UL
+#define POWER_SAVE_WAKE_STEP_W 2000
+
+// Time spent online after the join: MQTT connect and retained messages,
+// the flush, and one 12-bit DS18B20 conversion (750 ms).
+#define POWER_SAVE_AWAKE_MS 2500UL
+
+// Join time while waking. A cached join skips the scan and DHCP; every
+// (FAST_CONNECT_MAX_REUSE + 1)th join is a full one. Planning figures, the
+// node reports the real one on <node>/boot/wifi.
+#define POWER_SAVE_CACHED_JOIN_MS 1000UL
+#define POWER_SAVE_SCAN_JOIN_MS 4000UL
+
+// Two-state power model for EnergyBudget and the pack it runs from.
+#define POWER_SAVE_IDLE_MW 66       // modem sleep, ~20 mA at 3.3 V
+#define POWER_SAVE_RADIO_MW 264     // extra while associated, ~80 mA
+#define POWER_SAVE_PACK_WH 46       // 5S1P, 2.5 Ah cells
+
+#endif
@@ -0,0 +1,73 @@
+#include "Psychrometrics.h"
+
+// 6.105 * exp(17.27 T / (237.7 + T)) hPa, in 0.1 Pa, T = -40, -39 ... 60 C.
+static const uint32_t SATURATION_DPA[PSYCHRO_TABLE_LEN] = {
+    185, 206, 228, 253, 280, 309, 342, 377, 416, 458,
+    504, 554, 608, 668, 732, 802, 878, 960, 1049, 1145,
+    1249, 1362, 1483, 1614, 1755, 1908, 2072, 2248, 2437, 2641,
+    2860, 3094, 3346, 3615, 3904, 4212, 4543, 4896, 5273, 5675,
+    6105, 6563, 7051, 7571, 8125, 8714, 9340, 10006, 10713, 11463,
+    12260, 13105, 14000, 14949, 15954, 17017, 18143, 19333, 20590, 21919,
+    23323, 24804, 26367, 28015, 29752, 31583, 33511, 35541, 37677, 39924,
+    42287, 44771, 47380, 50120, 52997, 56017, 59184, 62505, 65986, 69635,
+    73456, 77457, 81645, 86028, 90612, 95405, 100416, 105651, 111120, 116831,
+    122793, 129014, 135504, 142273, 149330, 156685, 164349, 172332, 180644, 189297,
+    198302,
+};
+
+#define CENTI_MIN (PSYCHRO_MIN_C * 100)
+#define CENTI_STEP (PSYCHRO_STEP_C * 100)
+#define CENTI_MAX (CENTI_MIN + (PSYCHRO_TABLE_LEN - 1) * CENTI_STEP)
+
+uint32_t Psychrometrics::saturationPressure(int16_t centiC) {
+    if (centiC <= CENTI_MIN) return SATURATION_DPA[0];
+    if (centiC >= CENTI_MAX) return SATURATION_DPA[PSYCHRO_TABLE_LEN - 1];
+    uint16_t offset = centiC - CENTI_MIN;
+    uint8_t i = offset / CENTI_STEP;
+    uint16_t frac = offset % CENTI_STEP;
+    uint32_t lo = SATURATION_DPA[i];
+    return lo + ((SATURATION_DPA[i + 1] - lo) * frac + CENTI_STEP / 2) / CENTI_STEP;
+}
+
+uint32_t Psychrometrics::vapourPressure(int16_t centiC, uint16_t centiRh) {
+    if (centiRh > 10000) centiRh = 10000;
+    return (saturationPressure(centiC) * centiRh + 5000) / 10000;
+}
+
+int16_t Psychrometrics::dewPoint(int16_t centiC, uint16_t centiRh) {
+    uint32_t e = vapourPressure(centiC, centiRh);
+    if (e <= SATURATION_DPA[0]) return CENTI_MIN;
+    if (e >= SATURATION_DPA[PSYCHRO_TABLE_LEN - 1]) return CENTI_MAX;
+
+    // Last point at or below e. RH <= 100 % puts the dew point at or below
+    // the air temperature, so walk down from there: a few steps indoors, and
+    // no hard-to-predict branches.
+    uint8_t lo = PSYCHRO_TABLE_LEN - 2;
+    if (centiC < CENTI_MAX - CENTI_STEP) lo = centiC <= CENTI_MIN ? 0 : (centiC - CENTI_MIN) / CENTI_STEP;
+    while (SATURATION_DPA[lo] > e) lo--;
+    uint8_t hi = lo + 1;
+    uint32_t span = SATURATION_DPA[hi] - SATURATION_DPA[lo];
+    return CENTI_MIN + lo * CENTI_STEP + ((e - SATURATION_DPA[lo]) * CENTI_STEP + span / 2) / span;
+}
+
+uint32_t Psychrometrics::absoluteHumidity(int16_t centiC, uint16_t centiRh) {
+    // e / (Rv T): 2166.8 mg K / (m3 Pa), with e in 0.1 Pa and T in 0.1 K.
+    uint32_t deciK = (centiC + 27315 + 5) / 10;
+    return (vapourPressure(centiC, centiRh) * 2167 + deciK / 2) / deciK;
+}
+
+int16_t Psychrometrics::apparentTemperature(int16_t centiC, uint16_t centiRh) {
+    // 0.33 C per hPa is 33 centi-C per 1000 dPa.
+    return centiC + (int16_t)((vapourPressure(centiC, centiRh) * 33 + 500) / 1000) - 400;
+}
+
+int32_t Psychrometrics::enthalpy(int16_t centiC, uint16_t centiRh, uint32_t pressurePa) {
+    uint32_t ePa = (vapourPressure(centiC, centiRh) + 5) / 10;
+    if (ePa >= pressurePa) ePa = pressurePa - 1;
+    // Humidity ratio 0.622 e / (p - e), in 1e-5 kg/kg.
+    uint32_t ratio = (62200 * ePa + (pressurePa - ePa) / 2) / (pressurePa - ePa);
+    // 1.006 T kJ/kg for the dry air, ratio * (2501 + 1.86 T) kJ/kg for the vapour.
+    int32_t dry = (int32_t)centiC * 1006 / 100;
+    uint32_t latent = ratio * (uint32_t)(250100 + (int32_t)centiC * 186 / 100) / 10000;
+    return dry + (int32_t)latent;
+}
@@ -0,0 +1,46 @@
+#ifndef PSYCHROMETRICS_H
+#define PSYCHROMETRICS_H
+
+#include <stdint.h>
+
+// Saturation vapour pressure table: PSYCHRO_TABLE_LEN points every
+// PSYCHRO_STEP_C from PSYCHRO_MIN_C. Temperatures outside are clamped.
+#define PSYCHRO_MIN_C -40
+#define PSYCHRO_STEP_C 1
+#define PSYCHRO_TABLE_LEN 101
+
+#define PSYCHRO_SEA_LEVEL_PA 101325
+
+// Integer dew point, absolute humidity, apparent temperature and enthalpy.
+//
+// Inputs are centi-degrees C and centi-percent RH (2150 = 21.50 C, 4500 =
+// 45.00 %). Saturation vapour pressure comes from a 404-byte table of the
+// same Magnus formula hem_htu used (6.105 hPa, 17.27, 237.7) with linear
+// interpolation; the dew point inverts the table. No float, no libm, so
+// nothing soft-float on the ESP8266.
+//
+// Against the old double formulas the dew point is within 0.03 C over
+// 7..32 C (0.05 C over -20..50 C, RH >= 20 %) and the apparent temperature
+// within 0.02 C; absolute humidity is within 0.25 % and enthalpy within
+// 0.1 kJ/kg (tests/src/psychrometrics_spec.cpp).
+class Psychrometrics {
+public:
+    // Pressures in deci-pascals (0.1 Pa).
+    static uint32_t saturationPressure(int16_t centiC);
+    static uint32_t vapourPressure(int16_t centiC, uint16_t centiRh);
+
+    // Centi-degrees C, clamped to the table range.
+    static int16_t dewPoint(int16_t centiC, uint16_t centiRh);
+
+    // Milligrams of water per cubic metre of air.
+    static uint32_t absoluteHumidity(int16_t centiC, uint16_t centiRh);
+
+    // Steadman's apparent temperature indoors (no wind, no sun), centi-C:
+    // T + 0.33 e(hPa) - 4.0, as hem_htu's "feels like".
+    static int16_t apparentTemperature(int16_t centiC, uint16_t centiRh);
+
+    // Moist air enthalpy in J per kg of dry air.
+    static int32_t enthalpy(int16_t centiC, uint16_t centiRh, uint32_t pressurePa = PSYCHRO_SEA_LEVEL_PA);
+};
+
+#endif
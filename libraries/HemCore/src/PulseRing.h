@@ -0,0 +1,58 @@
+#ifndef PULSE_RING_H
+#define PULSE_RING_H
+
+#include <stdint.h>
+
+// Single-producer/single-consumer ring of pulse timestamps.
+//
+// push() runs in the pulse ISR, pop() in loop(). Each side only ever writes
+// its own index, so no interrupt masking is needed on the single-core
+// ESP8266; the compiler barrier keeps the slot write ahead of the index
+// publish. SIZE must be a power of two (indices wrap with a mask).
+//
+// push() is forced inline so it ends up in the caller's ICACHE_RAM_ATTR ISR
+// rather than in flash.
+template <uint16_t SIZE>
+class PulseRing {
+    static_assert(SIZE >= 2 && (SIZE & (SIZE - 1)) == 0, "PulseRing SIZE must be a power of two");
+    static_assert(SIZE <= 0x8000, "PulseRing SIZE must fit the 16-bit index");
+
+public:
+    PulseRing() : _head(0), _tail(0), _overflows(0) {}
+
+    // ISR side. Returns false (and counts an overflow) if the ring is full;
+    // the newest pulse is the one dropped so the ones queued stay in order.
+    inline __attribute__((always_inline)) bool push(uint32_t timestamp) {
+        uint16_t head = _head;
+        if ((uint16_t)(head - _tail) >= SIZE) {
+            _overflows++;
+            return false;
+        }
+        _buf[head & (SIZE - 1)] = timestamp;
+        __asm__ __volatile__("" ::: "memory");
+        _head = head + 1;
+        return true;
+    }
+
+    // loop() side. Returns false when empty.
+    bool pop(uint32_t& timestamp) {
+        uint16_t tail = _tail;
+        if (tail == _head) return false;
+        timestamp = _buf[tail & (SIZE - 1)];
+        __asm__ __volatile__("" ::: "memory");
+        _tail = tail + 1;
+        return true;
+    }
+
+    uint16_t available() const { return (uint16_t)(_head - _tail); }
+    uint32_t overflows() const { return _overflows; }
+    static uint16_t capacity() { return SIZE; }
+
+private:
+    volatile uint32_t _buf[SIZE];
+    volatile uint16_t _head;
+    volatile uint16_t _tail;
+    volatile uint32_t _overflows;
+};
+
+#endif
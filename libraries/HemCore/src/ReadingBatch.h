@@ -0,0 +1,80 @@
+#ifndef READING_BATCH_H
+#define READING_BATCH_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+// One timestamped reading on a small numbered channel (the sketch owns the
+// channel -> meaning table and publishes it as a legend).
+struct Reading {
+    uint32_t atMs;
+    uint8_t channel;
+    int32_t value;
+};
+
+// Fixed-size ring of readings held while the radio is off. When full the
+// oldest reading is overwritten (and counted) so the newest data survives.
+// loop() side only; not for use from an ISR.
+template <uint16_t SIZE>
+class ReadingBatch {
+    static_assert(SIZE >= 2 && (SIZE & (SIZE - 1)) == 0, "ReadingBatch SIZE must be a power of two");
+
+public:
+    ReadingBatch() : _head(0), _tail(0), _dropped(0) {}
+
+    void push(uint32_t atMs, uint8_t channel, int32_t value) {
+        if ((uint16_t)(_head - _tail) >= SIZE) {
+            _tail++;
+            _dropped++;
+        }
+        Reading& r = _buf[_head & (SIZE - 1)];
+        r.atMs = atMs;
+        r.channel = channel;
+        r.value = value;
+        _head++;
+    }
+
+    uint16_t size() const { return (uint16_t)(_head - _tail); }
+    uint32_t dropped() const { return _dropped; }
+
+    // Oldest-first access.
+    const Reading& peek(uint16_t i) const { return _buf[(uint16_t)(_tail + i) & (SIZE - 1)]; }
+
+    // Forget the oldest n readings (after they have been published).
+    void drop(uint16_t n) {
+        if (n > size()) n = size();
+        _tail += n;
+    }
+
+    // Write as many of the oldest readings as fit into buf as
+    //   {"now":<nowMs>,"r":[[age_s,channel,value],...]}
+    // and return how many were written (0 if empty or nothing fits). The
+    // caller publishes buf and then calls drop() with the count.
+    uint16_t format(uint32_t nowMs, char* buf, size_t length) const {
+        int n = snprintf(buf, length, "{\"now\":%lu,\"r\":[", (unsigned long)nowMs);
+        if (n < 0 || (size_t)n >= length) return 0;
+
+        uint16_t written = 0;
+        for (uint16_t i = 0; i < size(); i++) {
+            const Reading& r = peek(i);
+            // Reserve room for the closing "]}".
+            size_t room = length - n - 2;
+            int m = snprintf(buf + n, room, "%s[%lu,%u,%ld]", written ? "," : "",
+                             (unsigned long)((nowMs - r.atMs) / 1000), r.channel, (long)r.value);
+            if (m < 0 || (size_t)m >= room) break;
+            n += m;
+            written++;
+        }
+        if (!written) return 0;
+        snprintf(buf + n, length - n, "]}");
+        return written;
+    }
+
+private:
+    Reading _buf[SIZE];
+    uint16_t _head;
+    uint16_t _tail;
+    uint32_t _dropped;
+};
+
+#endif
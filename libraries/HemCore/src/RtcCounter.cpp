@@ -0,0 +1,21 @@
+#if defined(ESP8266)
+
+#include "RtcCounter.h"
+#include <Arduino.h>
+
+RtcCounter::RtcCounter(uint8_t block) : _block(block) {}
+
+bool RtcCounter::load(uint32_t& value) {
+    uint32_t data[2];
+    if (!ESP.rtcUserMemoryRead(_block, data, sizeof(data))) return false;
+    if (data[0] != ~data[1]) return false;
+    value = data[0];
+    return true;
+}
+
+void RtcCounter::save(uint32_t value) {
+    uint32_t data[2] = { value, ~value };
+    ESP.rtcUserMemoryWrite(_block, data, sizeof(data));
+}
+
+#endif
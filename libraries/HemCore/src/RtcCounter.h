@@ -0,0 +1,21 @@
+#ifndef RTC_COUNTER_H
+#define RTC_COUNTER_H
+
+#include <stdint.h>
+
+// A 32-bit counter in RTC user memory: survives a reset or OTA, not a power
+// cycle. Stored with its complement so garbage after power-up is rejected.
+// Takes two blocks starting at block (see the map in README.md).
+class RtcCounter {
+public:
+    explicit RtcCounter(uint8_t block);
+
+    // False if RTC memory holds no valid value (first boot after power-up).
+    bool load(uint32_t& value);
+    void save(uint32_t value);
+
+private:
+    uint8_t _block;
+};
+
+#endif
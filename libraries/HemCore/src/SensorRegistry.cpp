@@ -0,0 +1,78 @@
+#include "SensorRegistry.h"
+#include <string.h>
+
+SensorRegistry::SensorRegistry(const char* prefix, float deadband, uint32_t maxAgeMs, uint32_t rescanMs)
+    : _prefix(prefix), _deadband(deadband), _maxAgeMs(maxAgeMs), _rescanMs(rescanMs),
+      _lastScanMs(0), _cycleUs(0), _rescanNeeded(true), _count(0) {}
+
+void SensorRegistry::beginDiscovery() {
+    for (uint8_t i = 0; i < _count; i++) _entries[i].present = false;
+}
+
+int8_t SensorRegistry::add(const uint8_t* rom) {
+    for (uint8_t i = 0; i < _count; i++) {
+        if (memcmp(_entries[i].rom, rom, 8) == 0) {
+            _entries[i].present = true;
+            return i;
+        }
+    }
+    if (_count >= SENSOR_REGISTRY_MAX) return -1;
+
+    static const char hex[] = "0123456789abcdef";
+    Entry& e = _entries[_count];
+    memcpy(e.rom, rom, 8);
+    size_t n = strlen(_prefix);
+    if (n > SENSOR_TOPIC_LEN - 17) n = SENSOR_TOPIC_LEN - 17;
+    memcpy(e.topic, _prefix, n);
+    for (uint8_t b = 0; b < 8; b++) {
+        e.topic[n++] = hex[rom[b] >> 4];
+        e.topic[n++] = hex[rom[b] & 0xF];
+    }
+    e.topic[n] = 0;
+    e.last = 0;
+    e.publishedMs = 0;
+    e.hasValue = false;
+    e.present = true;
+    return _count++;
+}
+
+void SensorRegistry::endDiscovery() {
+    uint8_t kept = 0;
+    for (uint8_t i = 0; i < _count; i++) {
+        if (!_entries[i].present) continue;
+        if (kept != i) _entries[kept] = _entries[i];
+        kept++;
+    }
+    _count = kept;
+}
+
+uint8_t SensorRegistry::count() const {
+    return _count;
+}
+
+const uint8_t* SensorRegistry::rom(uint8_t i) const {
+    return _entries[i].rom;
+}
+
+const char* SensorRegistry::topic(uint8_t i) const {
+    return _entries[i].topic;
+}
+
+bool SensorRegistry::due(uint8_t i, float value, uint32_t nowMs) const {
+    const Entry& e = _entries[i];
+    if (!e.hasValue) return true;
+    if (nowMs - e.publishedMs >= _maxAgeMs) return true;
+    float d = value - e.last;
+    return d > _deadband || d < -_deadband;
+}
+
+void SensorRegistry::published(uint8_t i, float value, uint32_t nowMs) {
+    Entry& e = _entries[i];
+    e.last = value;
+    e.publishedMs = nowMs;
+    e.hasValue = true;
+}
+
+uint32_t SensorRegistry::cycleUs() const {
+    return _cycleUs;
+}
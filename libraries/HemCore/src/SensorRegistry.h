@@ -0,0 +1,108 @@
+#ifndef SENSOR_REGISTRY_H
+#define SENSOR_REGISTRY_H
+
+#include <Arduino.h>
+
+#define SENSOR_REGISTRY_MAX 8
+// Prefix + 16 hex digits + NUL; "temp/" needs 22.
+#define SENSOR_TOPIC_LEN 24
+
+// 1-Wire sensors found at discovery time, each with its ROM, its MQTT topic
+// already formatted and what was last published for it.
+//
+// The read loop walks the table by index and reads each sensor by ROM, so
+// there is no bus search and no String building per cycle. A reading is
+// only worth publishing if it moved by more than the deadband or the last
+// publish is older than maxAgeMs (so the history still gets a point now and
+// then for resampling).
+//
+// Rediscovery keeps the publish state of sensors that are still there:
+//   beginDiscovery(); add(rom)...; endDiscovery();
+//
+// For DS18B20s on a DallasTemperature bus, rescan() and read() do the
+// whole cycle: the bus is searched at boot, every rescanMs (hot swap) and
+// after a failed read, and read() hands what is due to the callback.
+class SensorRegistry {
+public:
+    // Where a due reading goes, e.g. TelemetryStore::publishOrStore().
+    typedef void (*Publish)(const char* topic, float value);
+
+    SensorRegistry(const char* prefix, float deadband, uint32_t maxAgeMs, uint32_t rescanMs = 300000);
+
+    void beginDiscovery();
+    // Index of the sensor, or -1 if the table is full.
+    int8_t add(const uint8_t* rom);
+    // Drops sensors that were not add()ed since beginDiscovery().
+    void endDiscovery();
+
+    uint8_t count() const;
+    const uint8_t* rom(uint8_t i) const;
+    const char* topic(uint8_t i) const;
+
+    // True if value should be published now.
+    bool due(uint8_t i, float value, uint32_t nowMs) const;
+    void published(uint8_t i, float value, uint32_t nowMs);
+
+    // Search the bus if a rescan is due. True if it did. bus is a
+    // DallasTemperature.
+    template <class Bus>
+    bool rescan(Bus& bus, uint32_t nowMs) {
+        if (!_rescanNeeded && nowMs - _lastScanMs <= _rescanMs) return false;
+        bus.begin();
+        beginDiscovery();
+        uint8_t addr[8];
+        for (int i = 0; i < bus.getDeviceCount(); i++) {
+            if (bus.getAddress(addr, i)) add(addr);
+        }
+        endDiscovery();
+        _lastScanMs = nowMs;
+        _rescanNeeded = false;
+        return true;
+    }
+
+    // Read every known sensor by ROM (after requestTemperatures() has had
+    // its conversion time) and publish the ones that are due. No bus
+    // search, no heap. A sensor that does not answer triggers a rescan.
+    template <class Bus>
+    void read(Bus& bus, uint32_t nowMs, Publish publish) {
+        unsigned long start = micros();
+        for (uint8_t i = 0; i < _count; i++) {
+            float temp = bus.getTempF(_entries[i].rom);
+            // Above DEVICE_DISCONNECTED_F and below the DS18B20's 85 C reset value.
+            if (temp > -196.6f && temp < 185) {
+                if (due(i, temp, nowMs)) {
+                    publish(_entries[i].topic, temp);
+                    published(i, temp, nowMs);
+                }
+            } else {
+                _rescanNeeded = true;
+            }
+        }
+        _cycleUs = micros() - start;
+    }
+
+    // Time the last read() took, to keep an eye on it.
+    uint32_t cycleUs() const;
+
+private:
+    struct Entry {
+        uint8_t rom[8];
+        char topic[SENSOR_TOPIC_LEN];
+        float last;
+        uint32_t publishedMs;
+        bool hasValue;
+        bool present;
+    };
+
+    const char* _prefix;
+    float _deadband;
+    uint32_t _maxAgeMs;
+    uint32_t _rescanMs;
+    uint32_t _lastScanMs;
+    uint32_t _cycleUs;
+    bool _rescanNeeded;
+    Entry _entries[SENSOR_REGISTRY_MAX];
+    uint8_t _count;
+};
+
+#endif
@@ -0,0 +1,314 @@
+#include "TelemetryStore.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+// Block layout: 2-byte sample count, then the bit stream (MSB first).
+#define HEADER_BYTES 2
+#define CAPACITY_BITS ((TELEMETRY_BLOCK_SIZE - HEADER_BYTES) * 8)
+#define NO_SERIES 0xFF
+
+static void putBits(uint8_t* block, uint16_t& pos, uint32_t value, uint8_t n) {
+    while (n--) {
+        uint8_t* byte = block + HEADER_BYTES + (pos >> 3);
+        uint8_t mask = 0x80 >> (pos & 7);
+        if ((value >> n) & 1) {
+            *byte |= mask;
+        } else {
+            *byte &= ~mask;
+        }
+        pos++;
+    }
+}
+
+static uint32_t getBits(const uint8_t* block, uint16_t& pos, uint8_t n) {
+    uint32_t value = 0;
+    while (n--) {
+        value = (value << 1) | ((block[HEADER_BYTES + (pos >> 3)] >> (7 - (pos & 7))) & 1);
+        pos++;
+    }
+    return value;
+}
+
+TelemetryStore::TelemetryStore(TelemetrySpill* spill, Publisher publish)
+    : _spill(spill), _publish(publish), _seriesCount(0), _ramHead(0), _ramCount(0), _openBits(0),
+      _spilledSamples(0), _dropped(0), _replaySkip(0) {
+    memset(_open, 0, sizeof(_open));
+    resetState(_openState);
+}
+
+int8_t TelemetryStore::series(const char* topic, uint8_t decimals) {
+    for (uint8_t i = 0; i < _seriesCount; i++) {
+        if (strcmp(_series[i].topic, topic) == 0) return i;
+    }
+    if (_seriesCount >= TELEMETRY_MAX_SERIES) return -1;
+
+    Series& s = _series[_seriesCount];
+    strncpy(s.topic, topic, TELEMETRY_TOPIC_LEN - 1);
+    s.topic[TELEMETRY_TOPIC_LEN - 1] = 0;
+    s.decimals = decimals;
+    s.scale = 1;
+    for (uint8_t i = 0; i < decimals; i++) s.scale *= 10;
+    return _seriesCount++;
+}
+
+void TelemetryStore::append(int8_t series, uint32_t tSec, float value) {
+    if (series < 0 || series >= _seriesCount) return;
+    int32_t v = (int32_t)floorf(value * _series[series].scale + 0.5f);
+
+    if (!encode(_open, _openBits, _openState, series, tSec, v)) {
+        sealOpen();
+        encode(_open, _openBits, _openState, series, tSec, v);
+    }
+    uint16_t count = blockCount(_open) + 1;
+    _open[0] = count & 0xFF;
+    _open[1] = count >> 8;
+}
+
+bool TelemetryStore::empty() const {
+    return samples() == 0;
+}
+
+template <class F>
+uint32_t TelemetryStore::replayBlocks(F& handler, uint16_t maxBlocks) {
+    uint32_t handed = 0;
+    uint8_t buf[TELEMETRY_BLOCK_SIZE];
+
+    while (maxBlocks) {
+        bool complete;
+        if (_spill && _spill->count()) {
+            if (!_spill->peek(buf)) break;
+            handed += replayBlock(buf, handler, complete);
+            if (!complete) break;
+            _spilledSamples -= blockCount(buf);
+            _spill->drop();
+        } else if (_ramCount) {
+            handed += replayBlock(_ram[_ramHead], handler, complete);
+            if (!complete) break;
+            _ramHead = (_ramHead + 1) % TELEMETRY_RAM_BLOCKS;
+            _ramCount--;
+        } else if (blockCount(_open)) {
+            // Replay what is in the open block too; it just moves to RAM first.
+            sealOpen();
+            continue;
+        } else {
+            break;
+        }
+        maxBlocks--;
+    }
+    return handed;
+}
+
+uint32_t TelemetryStore::replay(Handler handler, uint16_t maxBlocks) {
+    return replayBlocks(handler, maxBlocks);
+}
+
+void TelemetryStore::publishOrStore(const char* topic, float value, uint8_t decimals, uint32_t nowSec) {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%.*f", decimals, value);
+    if (_publish && empty() && _publish(topic, buf)) return;
+    append(series(topic, decimals), nowSec, value);
+}
+
+uint32_t TelemetryStore::publishReplay(uint32_t nowSec, uint16_t maxBlocks) {
+    if (!_publish) return 0;
+    Publisher publish = _publish;
+    auto handler = [publish, nowSec](const char* topic, uint32_t tSec, float value, uint8_t decimals) {
+        char t[TELEMETRY_TOPIC_LEN + 8];
+        char buf[48];
+        snprintf(t, sizeof(t), "replay/%s", topic);
+        snprintf(buf, sizeof(buf), "{\"age_s\":%lu,\"v\":%.*f}",
+                 (unsigned long)(nowSec - tSec), decimals, value);
+        return publish(t, buf);
+    };
+    return replayBlocks(handler, maxBlocks);
+}
+
+uint32_t TelemetryStore::samples() const {
+    uint32_t n = _spilledSamples + blockCount(_open);
+    for (uint8_t i = 0; i < _ramCount; i++) {
+        n += blockCount(_ram[(_ramHead + i) % TELEMETRY_RAM_BLOCKS]);
+    }
+    return n;
+}
+
+uint32_t TelemetryStore::bytes() const {
+    uint32_t n = (uint32_t)_ramCount * TELEMETRY_BLOCK_SIZE;
+    if (blockCount(_open)) n += HEADER_BYTES + (_openBits + 7) / 8;
+    if (_spill) n += _spill->count() * TELEMETRY_BLOCK_SIZE;
+    return n;
+}
+
+uint32_t TelemetryStore::dropped() const {
+    return _dropped;
+}
+
+bool TelemetryStore::encode(uint8_t* block, uint16_t& bits, BlockState& state, int8_t series, uint32_t t, int32_t v) {
+    // Build the fields first so a sample never straddles two blocks.
+    uint32_t field[6];
+    uint8_t width[6];
+    uint8_t n = 0;
+
+    if (state.prev != NO_SERIES && state.next[state.prev] == series) {
+        field[n] = 0; width[n++] = 1;
+    } else {
+        field[n] = 0x10 | series; width[n++] = 5;
+    }
+
+    SeriesState& s = state.series[series];
+    if (!s.seen) {
+        field[n] = t;
+        width[n++] = 32;
+        field[n] = (uint32_t)v;
+        width[n++] = 32;
+    } else {
+        int32_t dt = (int32_t)(t - s.t);
+        int32_t dod = dt - s.dt;
+        if (dod == 0) {
+            field[n] = 0; width[n++] = 1;
+        } else if (dod >= -63 && dod <= 64) {
+            field[n] = (0x2u << 7) | (uint32_t)(dod + 63); width[n++] = 9;
+        } else if (dod >= -255 && dod <= 256) {
+            field[n] = (0x6u << 9) | (uint32_t)(dod + 255); width[n++] = 12;
+        } else if (dod >= -2047 && dod <= 2048) {
+            field[n] = (0xEu << 12) | (uint32_t)(dod + 2047); width[n++] = 16;
+        } else {
+            // Prefix and raw value as separate fields so none is wider than 32.
+            field[n] = 0xF; width[n++] = 4;
+            field[n] = (uint32_t)dod; width[n++] = 32;
+        }
+
+        int32_t dv = v - s.v;
+        if (dv == 0) {
+            field[n] = 0; width[n++] = 1;
+        } else if (dv >= -7 && dv <= 8) {
+            field[n] = (0x2u << 4) | (uint32_t)(dv + 7); width[n++] = 6;
+        } else if (dv >= -255 && dv <= 256) {
+            field[n] = (0x6u << 9) | (uint32_t)(dv + 255); width[n++] = 12;
+        } else if (dv >= -32767 && dv <= 32768) {
+            field[n] = (0xEu << 16) | (uint32_t)(dv + 32767); width[n++] = 20;
+        } else {
+            field[n] = 0xF; width[n++] = 4;
+            field[n] = (uint32_t)dv; width[n++] = 32;
+        }
+    }
+
+    uint16_t total = 0;
+    for (uint8_t i = 0; i < n; i++) total += width[i];
+    if (bits + total > CAPACITY_BITS) return false;
+
+    for (uint8_t i = 0; i < n; i++) putBits(block, bits, field[i], width[i]);
+
+    if (state.prev != NO_SERIES) state.next[state.prev] = series;
+    state.prev = series;
+    s.dt = s.seen ? (int32_t)(t - s.t) : 0;
+    s.t = t;
+    s.v = v;
+    s.seen = true;
+    return true;
+}
+
+void TelemetryStore::sealOpen() {
+    uint16_t count = blockCount(_open);
+    if (!count) return;
+
+    if (_ramCount == TELEMETRY_RAM_BLOCKS) {
+        const uint8_t* oldest = _ram[_ramHead];
+        if (_spill && _spill->push(oldest)) {
+            _spilledSamples += blockCount(oldest);
+        } else {
+            _dropped += blockCount(oldest);
+            // The replay cursor pointed into the block that was just lost.
+            if (!_spill || !_spill->count()) _replaySkip = 0;
+        }
+        _ramHead = (_ramHead + 1) % TELEMETRY_RAM_BLOCKS;
+        _ramCount--;
+    }
+
+    memcpy(_ram[(_ramHead + _ramCount) % TELEMETRY_RAM_BLOCKS], _open, TELEMETRY_BLOCK_SIZE);
+    _ramCount++;
+
+    memset(_open, 0, sizeof(_open));
+    resetState(_openState);
+    _openBits = 0;
+}
+
+template <class F>
+uint32_t TelemetryStore::replayBlock(const uint8_t* block, F& handler, bool& complete) {
+    BlockState state;
+    resetState(state);
+
+    uint16_t count = blockCount(block);
+    uint16_t pos = 0;
+    uint32_t handed = 0;
+
+    for (uint16_t i = 0; i < count; i++) {
+        uint8_t id = getBits(block, pos, 1) ? getBits(block, pos, 4) : state.next[state.prev];
+        if (state.prev != NO_SERIES) state.next[state.prev] = id;
+        state.prev = id;
+        SeriesState& s = state.series[id];
+        uint32_t t;
+        int32_t v;
+
+        if (!s.seen) {
+            t = getBits(block, pos, 32);
+            v = (int32_t)getBits(block, pos, 32);
+            s.dt = 0;
+        } else {
+            int32_t dod;
+            if (!getBits(block, pos, 1)) {
+                dod = 0;
+            } else if (!getBits(block, pos, 1)) {
+                dod = (int32_t)getBits(block, pos, 7) - 63;
+            } else if (!getBits(block, pos, 1)) {
+                dod = (int32_t)getBits(block, pos, 9) - 255;
+            } else if (!getBits(block, pos, 1)) {
+                dod = (int32_t)getBits(block, pos, 12) - 2047;
+            } else {
+                dod = (int32_t)getBits(block, pos, 32);
+            }
+            s.dt += dod;
+            t = s.t + s.dt;
+
+            int32_t dv;
+            if (!getBits(block, pos, 1)) {
+                dv = 0;
+            } else if (!getBits(block, pos, 1)) {
+                dv = (int32_t)getBits(block, pos, 4) - 7;
+            } else if (!getBits(block, pos, 1)) {
+                dv = (int32_t)getBits(block, pos, 9) - 255;
+            } else if (!getBits(block, pos, 1)) {
+                dv = (int32_t)getBits(block, pos, 16) - 32767;
+            } else {
+                dv = (int32_t)getBits(block, pos, 32);
+            }
+            v = s.v + dv;
+        }
+        s.t = t;
+        s.v = v;
+        s.seen = true;
+
+        if (i < _replaySkip) continue;
+        const Series& ser = _series[id];
+        if (!handler(ser.topic, t, (float)v / ser.scale, ser.decimals)) {
+            _replaySkip = i;
+            complete = false;
+            return handed;
+        }
+        handed++;
+    }
+
+    _replaySkip = 0;
+    complete = true;
+    return handed;
+}
+
+void TelemetryStore::resetState(BlockState& state) {
+    memset(state.series, 0, sizeof(state.series));
+    memset(state.next, NO_SERIES, sizeof(state.next));
+    state.prev = NO_SERIES;
+}
+
+uint16_t TelemetryStore::blockCount(const uint8_t* block) {
+    return block[0] | (block[1] << 8);
+}
@@ -0,0 +1,131 @@
+#ifndef TELEMETRY_STORE_H
+#define TELEMETRY_STORE_H
+
+#include <stdint.h>
+
+#define TELEMETRY_BLOCK_SIZE 256
+#define TELEMETRY_RAM_BLOCKS 8
+#define TELEMETRY_MAX_SERIES 16
+#define TELEMETRY_TOPIC_LEN 40
+
+// Where full blocks go once RAM is full. FIFO of TELEMETRY_BLOCK_SIZE
+// blocks; see LittleFSSpill for the flash-backed one.
+class TelemetrySpill {
+public:
+    virtual ~TelemetrySpill() {}
+    virtual bool push(const uint8_t* block) = 0;
+    // Copy the oldest block without removing it.
+    virtual bool peek(uint8_t* block) = 0;
+    virtual void drop() = 0;
+    virtual uint32_t count() const = 0;
+};
+
+// Store-and-forward buffer for readings taken while the broker is
+// unreachable.
+//
+// Samples from all series are interleaved, in arrival order, into
+// fixed-size blocks. Inside a block each series is Gorilla-style coded
+// against its own previous sample:
+//
+//   series id   '0' if it is the one that followed the previous series last
+//               time (nodes publish in a fixed order), else '1'+4
+//   timestamp   delta-of-delta: '0' | '10'+7 | '110'+9 | '1110'+12 | '1111'+32
+//   value       fixed-point (value * 10^decimals) delta:
+//               '0' | '10'+4 | '110'+9 | '1110'+16 | '1111'+32
+//
+// The first sample of a series in a block is stored raw, so every block
+// decodes on its own. The sensors here report a fixed number of decimals,
+// so integer deltas beat XOR-ing float bit patterns. temp.json (15 s,
+// 0.01 F) comes out at about 9 bits per sample.
+//
+// When all RAM blocks are full the oldest goes to the spill (if any),
+// otherwise it is dropped. replay() hands samples back oldest first and
+// only forgets a block once the handler has accepted all of it.
+//
+// With a publisher the store also does the sketches' side of it:
+// publishOrStore() for live readings and publishReplay() to send the
+// backlog once the broker is back.
+class TelemetryStore {
+public:
+    // Return false to stop; the sample is offered again on the next replay().
+    typedef bool (*Handler)(const char* topic, uint32_t tSec, float value, uint8_t decimals);
+
+    // Send one message; false if it did not go out (offline, broker gone).
+    // Usually PubSubClient::publish() behind a connected() check.
+    typedef bool (*Publisher)(const char* topic, const char* payload);
+
+    explicit TelemetryStore(TelemetrySpill* spill = nullptr, Publisher publish = nullptr);
+
+    // Find or register a series. The topic is copied. -1 if the table is full.
+    int8_t series(const char* topic, uint8_t decimals);
+
+    // Store one sample. tSec must not go backwards within a series.
+    void append(int8_t series, uint32_t tSec, float value);
+
+    bool empty() const;
+
+    // Replay up to maxBlocks blocks. Returns the number of samples handed out.
+    uint32_t replay(Handler handler, uint16_t maxBlocks = 1);
+
+    // Publish value on topic now if nothing is waiting ahead of it and the
+    // publisher takes it, else store it (at nowSec) for publishReplay().
+    void publishOrStore(const char* topic, float value, uint8_t decimals, uint32_t nowSec);
+
+    // replay() through the publisher, to replay/<topic> as
+    // {"age_s":..,"v":..} so the logger can put each sample back at the
+    // right time. Stops at the first message that does not go out.
+    uint32_t publishReplay(uint32_t nowSec, uint16_t maxBlocks = 1);
+
+    // Samples and bytes currently held (RAM + spill).
+    uint32_t samples() const;
+    uint32_t bytes() const;
+    // Samples lost because RAM and spill were full.
+    uint32_t dropped() const;
+
+private:
+    struct SeriesState {
+        uint32_t t;
+        int32_t dt;
+        int32_t v;
+        bool seen;
+    };
+
+    struct BlockState {
+        SeriesState series[TELEMETRY_MAX_SERIES];
+        uint8_t next[TELEMETRY_MAX_SERIES];
+        uint8_t prev;
+    };
+
+    struct Series {
+        char topic[TELEMETRY_TOPIC_LEN];
+        uint8_t decimals;
+        int32_t scale;
+    };
+
+    bool encode(uint8_t* block, uint16_t& bits, BlockState& state, int8_t series, uint32_t t, int32_t v);
+    void sealOpen();
+    template <class F> uint32_t replayBlocks(F& handler, uint16_t maxBlocks);
+    template <class F> uint32_t replayBlock(const uint8_t* block, F& handler, bool& complete);
+
+    static void resetState(BlockState& state);
+    static uint16_t blockCount(const uint8_t* block);
+
+    TelemetrySpill* _spill;
+    Publisher _publish;
+    Series _series[TELEMETRY_MAX_SERIES];
+    uint8_t _seriesCount;
+
+    // RAM ring of sealed blocks, plus one open block being written.
+    uint8_t _ram[TELEMETRY_RAM_BLOCKS][TELEMETRY_BLOCK_SIZE];
+    uint8_t _ramHead;
+    uint8_t _ramCount;
+    uint8_t _open[TELEMETRY_BLOCK_SIZE];
+    uint16_t _openBits;
+    BlockState _openState;
+
+    uint32_t _spilledSamples;
+    uint32_t _dropped;
+    uint16_t _replaySkip;
+};
+
+#endif
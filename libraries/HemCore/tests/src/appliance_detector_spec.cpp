@@ -0,0 +1,269 @@
+#include "ApplianceDetector.h"
+#include "BDDTest.h"
+#include "Replay.h"
+#include "trace.h"
+
+#include <algorithm>
+#include <chrono>
+#include <string.h>
+#include <vector>
+
+static std::vector<ApplianceEvent> events;
+
+static void collect(const ApplianceEvent& e) {
+    events.push_back(e);
+}
+
+// Seeds from MEMORIES.md.
+static void seed(ApplianceDetector& d) {
+    d.addSignature("fridge", 167);
+    d.addSignature("heater", 1020);
+    d.addSignature("wh_lower", 3674);
+    d.addSignature("wh_upper", 4483);
+}
+
+// Feed a constant load for durationMs; returns the time reached.
+static uint32_t hold(ApplianceDetector& d, uint32_t t, uint32_t watts, uint32_t durationMs) {
+    uint32_t interval = 3600000UL / watts;
+    for (uint32_t end = t + durationMs; t + interval <= end;) {
+        t += interval;
+        d.pulse(t, watts);
+    }
+    return t;
+}
+
+
+int test_detector_pairs_run() {
+    IT("detects a fridge cycle on top of a base load and pairs it into a run");
+    events.clear();
+    ApplianceDetector d(collect);
+    seed(d);
+    uint32_t t = hold(d, 0, 400, 120000);
+    t = hold(d, t, 570, 13 * 60000);
+    hold(d, t, 400, APPLIANCE_MIN_OFF_MS + 60000);
+
+    IS_EQUAL(events.size(), 2);
+    IS_EQUAL(events[0].edge, APPLIANCE_ON);
+    IS_TRUE(strcmp(events[0].name, "fridge") == 0);
+    IS_EQUAL(events[1].edge, APPLIANCE_OFF);
+    IS_EQUAL(events[1].signature, 0);
+    IS_TRUE(events[1].runMs > 12 * 60000 && events[1].runMs < 14 * 60000);
+    IS_EQUAL(d.signatureRuns(0), 1);
+    END_IT
+}
+
+int test_detector_ignores_noise() {
+    IT("ignores pulse-to-pulse jitter and small drift");
+    events.clear();
+    ApplianceDetector d(collect);
+    seed(d);
+    uint32_t t = 0;
+    for (int i = 0; i < 2000; i++) {
+        uint32_t w = 2000 + (i % 7) * 4 + i / 100;
+        t += 3600000UL / w;
+        d.pulse(t, w);
+    }
+    IS_EQUAL(events.size(), 0);
+    END_IT
+}
+
+int test_detector_handover() {
+    IT("splits a water heater element handover into OFF + ON");
+    events.clear();
+    ApplianceDetector d(collect);
+    seed(d);
+    uint32_t t = hold(d, 0, 300, 60000);
+    t = hold(d, t, 4783, 10 * 60000);
+    t = hold(d, t, 3974, 10 * 60000);
+    hold(d, t, 300, APPLIANCE_MIN_OFF_MS + 60000);
+
+    // The upper element's OFF is held back, so it follows the lower's ON.
+    IS_EQUAL(events.size(), 4);
+    IS_TRUE(strcmp(events[0].name, "wh_upper") == 0);
+    IS_EQUAL(events[1].edge, APPLIANCE_ON);
+    IS_TRUE(strcmp(events[1].name, "wh_lower") == 0);
+    IS_EQUAL(events[2].edge, APPLIANCE_OFF);
+    IS_TRUE(strcmp(events[2].name, "wh_upper") == 0);
+    IS_TRUE(events[2].runMs > 9 * 60000);
+    IS_EQUAL(events[2].atMs, events[1].atMs);
+    IS_EQUAL(events[3].edge, APPLIANCE_OFF);
+    IS_TRUE(strcmp(events[3].name, "wh_lower") == 0);
+    END_IT
+}
+
+int test_detector_learns() {
+    IT("learns an unknown appliance and adapts seeded centroids");
+    events.clear();
+    ApplianceDetector d(collect);
+    seed(d);
+    uint32_t t = hold(d, 0, 300, 60000);
+    for (int i = 0; i < 5; i++) {
+        t = hold(d, t, 300 + 1500, 5 * 60000);   // kettle-ish, not in the table
+        t = hold(d, t, 300, 5 * 60000);
+        t = hold(d, t, 300 + 1080, 5 * 60000);   // heater running a bit hot
+        t = hold(d, t, 300, 5 * 60000);
+    }
+    IS_EQUAL(d.signatureCount(), 5);
+    IS_TRUE(d.signatureName(4) == nullptr);
+    IS_TRUE(d.signatureWatts(4) > 1450 && d.signatureWatts(4) < 1550);
+    // Learned on its third step (the second ON), so the first run is lost
+    IS_EQUAL(d.signatureRuns(4), 4);
+    IS_TRUE(d.signatureWatts(1) > 1040);
+    IS_EQUAL(d.signatureRuns(1), 5);
+    END_IT
+}
+
+int test_detector_bridges_bursts() {
+    IT("keeps a thermostat-switched heater burst as one run");
+    events.clear();
+    ApplianceDetector d(collect);
+    seed(d);
+    uint32_t t = hold(d, 0, 2000, 60000);
+    for (int run = 0; run < 3; run++) {
+        // 6 s on / 5 s off for 15 min, then off for 45 min
+        for (uint32_t end = t + 15 * 60000; t < end;) {
+            t = hold(d, t, 2960, 6000);
+            t = hold(d, t, 2000, 5000);
+        }
+        t = hold(d, t, 2000, 45 * 60000);
+    }
+
+    IS_EQUAL(events.size(), 6);
+    IS_EQUAL(d.signatureRuns(1), 3);
+    for (size_t i = 0; i < events.size(); i++) {
+        IS_EQUAL(events[i].signature, 1);
+        IS_EQUAL(events[i].edge, i % 2 ? APPLIANCE_OFF : APPLIANCE_ON);
+    }
+    IS_TRUE(events[1].runMs > 14 * 60000 && events[1].runMs < 16 * 60000);
+    END_IT
+}
+
+// Median length of the runs reported for a signature, in minutes.
+static double medianRunMin(uint8_t index) {
+    std::vector<uint32_t> runs;
+    for (size_t i = 0; i < events.size(); i++) {
+        if (events[i].signature == index && events[i].runMs) runs.push_back(events[i].runMs);
+    }
+    if (runs.empty()) return 0;
+    std::sort(runs.begin(), runs.end());
+    return runs[runs.size() / 2] / 60000.0;
+}
+
+// Base load with a step of each size in turn, cycles times. Each stays off
+// long enough to end its run.
+static uint32_t cycle(ApplianceDetector& d, uint32_t t, const uint32_t* sizes, size_t count, int cycles) {
+    for (int i = 0; i < cycles; i++) {
+        for (size_t j = 0; j < count; j++) {
+            t = hold(d, t, 300 + sizes[j], 2 * 60000);
+            t = hold(d, t, 300, APPLIANCE_MIN_OFF_MS + 60000);
+        }
+    }
+    return t;
+}
+
+int test_detector_ignores_transients() {
+    IT("does not learn one-off steps, however many distinct ones it sees");
+    events.clear();
+    ApplianceDetector d(collect);
+    seed(d);
+    const uint32_t transients[] = { 250, 330, 430, 560, 730, 1250, 2400, 2900, 5500, 6500, 8000, 9500 };
+    uint32_t t = hold(d, 0, 300, 60000);
+    t = cycle(d, t, transients, sizeof(transients) / sizeof(transients[0]), 1);
+    IS_EQUAL(events.size(), 24);
+    IS_EQUAL(d.signatureCount(), 4);
+
+    const uint32_t kettle[] = { 1500 };
+    events.clear();
+    cycle(d, t, kettle, 1, 3);
+    IS_EQUAL(d.signatureCount(), 5);
+    IS_EQUAL(events[0].signature, -1);
+    IS_EQUAL(events[2].signature, 4);
+    IS_EQUAL(events.back().signature, 4);
+    IS_EQUAL(d.signatureRuns(4), 2);
+    END_IT
+}
+
+int test_detector_evicts() {
+    IT("replaces the learned signature with the lowest weight once the table is full");
+    events.clear();
+    ApplianceDetector d(collect);
+    seed(d);
+    const uint32_t kettle[] = { 1500 };
+    const uint32_t others[] = { 2400, 6000, 8000 };
+    uint32_t t = hold(d, 0, 300, 60000);
+    t = cycle(d, t, kettle, 1, 5);
+    for (size_t i = 0; i < 3; i++) t = cycle(d, t, &others[i], 1, 2);
+    IS_EQUAL(d.signatureCount(), APPLIANCE_MAX_SIGNATURES);
+
+    const uint32_t dryer[] = { 600 };
+    events.clear();
+    cycle(d, t, dryer, 1, 3);
+    IS_EQUAL(d.signatureCount(), APPLIANCE_MAX_SIGNATURES);
+    IS_EQUAL(events.back().signature, 5);
+    IS_TRUE(d.signatureWatts(5) > 550 && d.signatureWatts(5) < 650);
+    IS_TRUE(d.signatureWatts(4) > 1450 && d.signatureWatts(4) < 1550);
+    IS_TRUE(strcmp(d.signatureName(0), "fridge") == 0);
+    IS_TRUE(d.signatureWatts(6) > 5500 && d.signatureWatts(7) > 7500);
+    END_IT
+}
+
+int test_detector_replay() {
+    IT("replays power.json faster than 1000x real time");
+    std::vector<ReplaySample> series;
+    if (!replay_load("../../../power.json", "POWER_JSON", series)) {
+        LOG("(power.json not found, skipped) ");
+        END_IT
+    }
+
+    events.clear();
+    ApplianceDetector d(collect);
+    seed(d);
+
+    auto start = std::chrono::steady_clock::now();
+    uint64_t tUs = 0;
+    for (size_t i = 0; i < series.size(); i++) {
+        tUs += (uint64_t)(3600000000.0 / series[i].value);
+        d.pulse((uint32_t)(tUs / 1000), (uint32_t)(series[i].value + 0.5));
+    }
+    double wallS = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double speedup = (tUs / 1e6) / (wallS > 0 ? wallS : 1e-9);
+
+    LOG("(" << events.size() << " events, " << (int)speedup << "x; runs");
+    for (uint8_t i = 0; i < d.signatureCount(); i++) {
+        LOG(" " << (d.signatureName(i) ? d.signatureName(i) : "?") << "@" << d.signatureWatts(i)
+            << "=" << d.signatureRuns(i) << "/" << medianRunMin(i) << "min");
+    }
+    LOG(") ");
+
+    IS_TRUE(speedup > 1000);
+    double minutes = tUs / 60e6;
+    // The heater bursts 6 s on / 4 s off; the bursts come every ~62 min
+    // (MEMORIES.md) and last a few minutes (23 % duty at most).
+    IS_TRUE(d.signatureRuns(1) > 0);
+    double heaterPeriod = minutes / d.signatureRuns(1);
+    IS_TRUE(heaterPeriod > 50 && heaterPeriod < 80);
+    IS_TRUE(medianRunMin(1) > 3 && medianRunMin(1) < 15);
+    // Only ~60 fridge-sized ON steps stand clear of the other loads in this
+    // capture, so its ~13 min cycle shows up as runs about once an hour
+    // (PeriodicityBank finds the cycle itself in the 1-minute means). Runs
+    // still last a compressor cycle, not a pulse.
+    IS_TRUE(d.signatureRuns(0) > 40 && d.signatureRuns(0) < 60);
+    IS_TRUE(medianRunMin(0) > 10 && medianRunMin(0) < 25);
+    END_IT
+}
+
+
+int main()
+{
+    SUITE("ApplianceDetector");
+    test_detector_pairs_run();
+    test_detector_ignores_noise();
+    test_detector_handover();
+    test_detector_bridges_bursts();
+    test_detector_learns();
+    test_detector_ignores_transients();
+    test_detector_evicts();
+    test_detector_replay();
+
+    FINISH
+}
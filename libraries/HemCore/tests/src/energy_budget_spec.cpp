@@ -0,0 +1,128 @@
+#include "EnergyBudget.h"
+#include "ApplianceDetector.h"
+#include "PowerSave.h"
+#include "BDDTest.h"
+#include "Replay.h"
+#include "trace.h"
+
+#include <stdlib.h>
+#include <vector>
+
+// hem_pwrmtr's power-save numbers (PowerSave.h).
+#define IDLE_MW POWER_SAVE_IDLE_MW
+#define RADIO_MW POWER_SAVE_RADIO_MW
+#define PACK_WH POWER_SAVE_PACK_WH
+
+
+int test_budget_hour_rollover() {
+    IT("accounts modem-on time per hour, splitting wakes at the boundary");
+    EnergyBudget budget(IDLE_MW, RADIO_MW);
+    budget.radioOn(0);
+    budget.radioOff(60000);
+    // Half an hour in, 1 min on: scaled to 2 min per hour.
+    IS_EQUAL(budget.onMsPerHour(1800000), 120000);
+
+    budget.radioOn(3590000);
+    budget.update(3600000);
+    IS_EQUAL(budget.onMsPerHour(3600000), 70000);
+    budget.radioOff(3620000);
+    budget.update(7200000);
+    IS_EQUAL(budget.onMsPerHour(7200000), 20000);
+    END_IT
+}
+
+int test_budget_projection() {
+    IT("projects battery life from the measured duty cycle");
+    EnergyBudget always(IDLE_MW, RADIO_MW), never(IDLE_MW, RADIO_MW);
+    always.radioOn(0);
+    always.update(ENERGY_BUDGET_HOUR_MS);
+    never.update(ENERGY_BUDGET_HOUR_MS);
+    IS_EQUAL(always.averageMw(ENERGY_BUDGET_HOUR_MS), IDLE_MW + RADIO_MW);
+    IS_EQUAL(never.averageMw(ENERGY_BUDGET_HOUR_MS), IDLE_MW);
+    // 46 Wh at 50 % over 330 mW.
+    IS_EQUAL(always.projectedHours(ENERGY_BUDGET_HOUR_MS, PACK_WH, 50), 69);
+    END_IT
+}
+
+static std::vector<uint32_t> bigSteps;
+
+static void onStep(const ApplianceEvent& e) {
+    if ((uint32_t)abs(e.deltaW) >= POWER_SAVE_WAKE_STEP_W) bigSteps.push_back(e.atMs);
+}
+
+int test_budget_simulation() {
+    IT("simulates power-save mode over power.json");
+    std::vector<ReplaySample> series;
+    if (!replay_load("../../../power.json", "POWER_JSON", series)) {
+        LOG("(power.json not found, skipped) ");
+        END_IT
+    }
+
+    // Large steps that would wake the radio early.
+    bigSteps.clear();
+    ApplianceDetector detector(onStep);
+    uint64_t tUs = 0;
+    for (size_t i = 0; i < series.size(); i++) {
+        tUs += (uint64_t)(3600000000.0 / series[i].value);
+        detector.pulse((uint32_t)(tUs / 1000), (uint32_t)(series[i].value + 0.5));
+    }
+    uint32_t endMs = (uint32_t)(tUs / 1000);
+
+    EnergyBudget always(IDLE_MW, RADIO_MW), saving(IDLE_MW, RADIO_MW);
+    always.radioOn(0);
+
+    uint32_t lastWake = 0;
+    uint32_t wakes = 0, stepWakes = 0;
+    size_t step = 0;
+    uint64_t onMsTotal = 0;
+    for (uint32_t now = 0; now < endMs; now += 1000) {
+        int32_t sinceWake = (int32_t)(now - lastWake);
+        bool due = sinceWake >= (int32_t)POWER_SAVE_FLUSH_INTERVAL_MS;
+        bool stepped = false;
+        while (step < bigSteps.size() && bigSteps[step] <= now) {
+            stepped = true;
+            step++;
+        }
+        if (stepped && sinceWake >= (int32_t)POWER_SAVE_MIN_WAKE_GAP_MS) {
+            due = true;
+            stepWakes++;
+        }
+        if (due) {
+            // FastConnect does a full scan + DHCP once the cached lease
+            // has been reused FAST_CONNECT_MAX_REUSE times.
+            uint32_t joinMs = wakes % (FAST_CONNECT_MAX_REUSE + 1) == 0 ? POWER_SAVE_SCAN_JOIN_MS
+                                                                        : POWER_SAVE_CACHED_JOIN_MS;
+            uint32_t wakeMs = joinMs + POWER_SAVE_AWAKE_MS;
+            saving.radioOn(now);
+            saving.radioOff(now + wakeMs);
+            onMsTotal += wakeMs;
+            // finishWake() restarts the interval once the join is done.
+            lastWake = now + joinMs;
+            wakes++;
+        }
+        always.update(now);
+        saving.update(now);
+    }
+
+    uint32_t hours = endMs / ENERGY_BUDGET_HOUR_MS;
+    uint32_t lifeAlways = always.projectedHours(endMs, PACK_WH, 100);
+    uint32_t lifeSaving = saving.projectedHours(endMs, PACK_WH, 100);
+    LOG("(" << hours << " h, " << wakes << " wakes (" << stepWakes << " on steps), modem on "
+        << onMsTotal / hours / 1000 << " s/h vs 3600 s/h; projected life "
+        << lifeSaving << " h vs " << lifeAlways << " h) ");
+
+    IS_TRUE(saving.onMsPerHour(endMs) < 120000);
+    IS_TRUE(lifeSaving > 3 * lifeAlways);
+    END_IT
+}
+
+
+int main()
+{
+    SUITE("EnergyBudget");
+    test_budget_hour_rollover();
+    test_budget_projection();
+    test_budget_simulation();
+
+    FINISH
+}
@@ -0,0 +1,153 @@
+#include "EnergyWindow.h"
+#include "BDDTest.h"
+#include "Replay.h"
+#include "trace.h"
+
+#include <vector>
+
+static std::vector<EnergySummary> closed;
+
+static void collect(const EnergySummary& s) {
+    closed.push_back(s);
+}
+
+// Feed a constant load from startMs for count pulses; returns the last pulse time.
+static uint32_t steady(EnergyWindow& w, uint32_t startMs, uint32_t watts, int count) {
+    uint32_t intervalUs = 3600000000UL / watts;
+    uint64_t tUs = (uint64_t)startMs * 1000;
+    for (int i = 0; i < count; i++) {
+        tUs += intervalUs;
+        w.pulse((uint32_t)(tUs / 1000), intervalUs, watts);
+    }
+    return (uint32_t)(tUs / 1000);
+}
+
+
+int test_energy_window_steady() {
+    IT("reports energy, mean and pulse count for a steady load");
+    closed.clear();
+    EnergyWindow w(60000, collect);
+    // 3600 W: one pulse per second.
+    steady(w, 0, 3600, 185);
+    IS_EQUAL(closed.size(), 3);
+    for (size_t i = 1; i < closed.size(); i++) {
+        IS_EQUAL(closed[i].startMs, closed[i - 1].startMs + 60000);
+        IS_EQUAL(closed[i].mWh, 60000);
+        IS_EQUAL(closed[i].meanW, 3600);
+        IS_EQUAL(closed[i].minW, 3600);
+        IS_EQUAL(closed[i].maxW, 3600);
+        IS_EQUAL(closed[i].pulses, 60);
+    }
+    END_IT
+}
+
+int test_energy_window_low_load() {
+    IT("spreads long pulse intervals across short windows");
+    closed.clear();
+    EnergyWindow w(10000, collect);
+    // 167 W: a pulse every ~21.6 s, so most 10 s windows see no pulse at all.
+    steady(w, 0, 167, 20);
+    IS_TRUE(closed.size() > 30);
+    int empty = 0;
+    for (size_t i = 1; i < closed.size(); i++) {
+        if (closed[i].pulses == 0) empty++;
+        IS_TRUE(closed[i].meanW >= 166 && closed[i].meanW <= 167);
+    }
+    IS_TRUE(empty > 10);
+    END_IT
+}
+
+int test_energy_window_min_max() {
+    IT("tracks min and max interval power inside a window");
+    closed.clear();
+    EnergyWindow w(60000, collect);
+    uint32_t t = steady(w, 0, 1200, 10);
+    t = steady(w, t, 4500, 10);
+    steady(w, t, 1200, 100);
+    IS_TRUE(closed.size() >= 1);
+    IS_EQUAL(closed[0].minW, 1200);
+    IS_EQUAL(closed[0].maxW, 4500);
+    END_IT
+}
+
+int test_energy_window_tick() {
+    IT("closes idle windows after the grace period without flooding");
+    closed.clear();
+    EnergyWindow w(10000, collect);
+    uint32_t t = steady(w, 0, 3600, 5);
+    w.tick(t + ENERGY_WINDOW_GRACE_MS - 1);
+    IS_EQUAL(closed.size(), 0);
+    w.tick(t + ENERGY_WINDOW_GRACE_MS + 10000);
+    IS_EQUAL(closed.size(), 1);
+    IS_EQUAL(closed[0].mWh, 5000);
+    // An hour later: one more (empty) window at most, not 360 of them.
+    w.tick(t + 3600000);
+    IS_TRUE(closed.size() <= 2);
+    END_IT
+}
+
+int test_energy_window_replay() {
+    IT("conserves energy over the power.json replay");
+    std::vector<ReplaySample> series;
+    if (!replay_load("../../../power.json", "POWER_JSON", series)) {
+        LOG("(power.json not found, skipped) ");
+        END_IT
+    }
+
+    closed.clear();
+    EnergyWindow w10(10000, collect);
+    EnergyWindow w60(60000, collect);
+    EnergyWindow w900(900000, collect);
+    EnergyWindow* windows[] = { &w10, &w60, &w900 };
+
+    uint64_t tUs = 0;
+    for (size_t i = 1; i < series.size(); i++) {
+        uint32_t intervalUs = (uint32_t)(3600000000.0 / series[i].value);
+        tUs += intervalUs;
+        for (EnergyWindow* w : windows) {
+            w->pulse((uint32_t)(tUs / 1000), intervalUs, (uint32_t)(series[i].value + 0.5));
+        }
+    }
+
+    uint64_t mWh[3] = { 0, 0, 0 };
+    uint32_t count[3] = { 0, 0, 0 };
+    for (const EnergySummary& s : closed) {
+        int k = s.lengthMs == 10000 ? 0 : s.lengthMs == 60000 ? 1 : 2;
+        mWh[k] += s.mWh;
+        count[k]++;
+    }
+    LOG("(" << count[0] << "/" << count[1] << "/" << count[2] << " windows vs "
+        << series.size() << " pulse publishes) ");
+
+    // Every closed 15 min window holds the same energy as the 10 s and 1 min
+    // windows covering it, give or take per-window rounding and the tail.
+    uint64_t span = (uint64_t)count[2] * 900000;
+    IS_TRUE(span > 40ULL * 3600000);
+    for (int k = 0; k < 2; k++) {
+        uint64_t perLong = k == 0 ? 90 : 15;
+        uint64_t covered = 0;
+        uint32_t n = 0;
+        for (const EnergySummary& s : closed) {
+            if (s.lengthMs == (k == 0 ? 10000u : 60000u) && n < count[2] * perLong) {
+                covered += s.mWh;
+                n++;
+            }
+        }
+        IS_TRUE(covered <= mWh[2] + n);
+        IS_TRUE(covered + n >= mWh[2]);
+    }
+    END_IT
+}
+
+
+int main()
+{
+    SUITE("EnergyWindow");
+    test_energy_window_steady();
+    test_energy_window_low_load();
+    test_energy_window_min_max();
+    test_energy_window_tick();
+    test_energy_window_replay();
+
+    FINISH
+}
@@ -0,0 +1,164 @@
+#include "FastConnect.h"
+#include "BDDTest.h"
+#include "trace.h"
+
+// The radio: the AP comes back at upAt (0 = never), and every join the
+// node starts is counted. A cached entry is offered while haveCache is set.
+class FakeLink : public FastConnect {
+public:
+    FakeLink() : FastConnect("ssid", "password", "test"),
+                 upAt(0), haveCache(false), cachedJoins(0), scanJoins(0), saves(0), savedUses(0) {}
+    unsigned long upAt;
+    bool haveCache;
+    int cachedJoins;
+    int scanJoins;
+    int saves;
+    uint8_t savedUses;
+
+protected:
+    bool linkUp() override {
+        return upAt && millis() >= upAt;
+    }
+    bool beginCached(uint8_t& uses) override {
+        if (!haveCache) return false;
+        cachedJoins++;
+        uses = 3;
+        return true;
+    }
+    void beginScan() override {
+        scanJoins++;
+    }
+    void saveCache(uint8_t uses) override {
+        saves++;
+        savedUses = uses;
+    }
+};
+
+// loop() of a node sampling every 15 s: one service() per 100 ms pass, for
+// ms of fake time. Returns the samples taken.
+static int run(FakeLink& link, unsigned long ms, bool& blocked) {
+    int samples = 0;
+    unsigned long lastSample = millis();
+    unsigned long end = millis() + ms;
+    blocked = false;
+    while (millis() < end) {
+        unsigned long before = millis();
+        link.service();
+        if (millis() != before) blocked = true;
+        if (millis() - lastSample >= 15000) {
+            lastSample = millis();
+            samples++;
+        }
+        delay(100);
+    }
+    return samples;
+}
+
+
+int test_join_nonblocking() {
+    IT("keeps loop() running while the AP is down and joins once it is back");
+    FakeLink link;
+    bool blocked;
+    int samples = run(link, 60000, blocked);
+    IS_FALSE(blocked);
+    IS_EQUAL(samples, 3);   // at 15, 30 and 45 s
+    IS_EQUAL(link.scanJoins, 1);
+    IS_EQUAL(link.saves, 0);
+
+    unsigned long start = millis() - 60000;
+    link.upAt = millis() + 500;
+    run(link, 1000, blocked);
+    IS_TRUE(link.service());
+    IS_EQUAL(link.scanJoins, 1);
+    IS_EQUAL(link.saves, 1);
+    IS_FALSE(link.usedCache());
+    IS_TRUE(link.connectMs() >= link.upAt - start);
+    IS_TRUE(link.connectMs() <= link.upAt - start + 100);
+    END_IT
+}
+
+int test_join_cached() {
+    IT("joins from the cache and counts the reuse");
+    FakeLink link;
+    link.haveCache = true;
+    link.upAt = millis() + 300;
+    bool blocked;
+    run(link, 1000, blocked);
+    IS_TRUE(link.service());
+    IS_EQUAL(link.cachedJoins, 1);
+    IS_EQUAL(link.scanJoins, 0);
+    IS_TRUE(link.usedCache());
+    IS_EQUAL(link.savedUses, 3);
+    END_IT
+}
+
+int test_join_fallback() {
+    IT("falls back to a scan once the targeted join times out");
+    FakeLink link;
+    link.haveCache = true;
+    bool blocked;
+    run(link, FAST_CONNECT_TIMEOUT_MS - 500, blocked);
+    IS_EQUAL(link.scanJoins, 0);
+    run(link, 1000, blocked);
+    IS_FALSE(blocked);
+    IS_EQUAL(link.cachedJoins, 1);
+    IS_EQUAL(link.scanJoins, 1);
+
+    link.upAt = millis() + 100;
+    run(link, 500, blocked);
+    IS_TRUE(link.service());
+    IS_FALSE(link.usedCache());
+    IS_EQUAL(link.savedUses, 0);
+    END_IT
+}
+
+int test_rejoin() {
+    IT("starts one new join when the link drops or the radio slept");
+    FakeLink link;
+    link.upAt = millis();
+    IS_TRUE(link.service());
+    IS_EQUAL(link.scanJoins, 0);
+    IS_EQUAL(link.saves, 1);
+
+    link.upAt = 0;
+    bool blocked;
+    run(link, 30000, blocked);
+    IS_FALSE(blocked);
+    IS_EQUAL(link.scanJoins, 1);
+    link.upAt = millis();
+    IS_TRUE(link.service());
+    IS_EQUAL(link.saves, 2);
+
+    // Radio put to sleep halfway through a join: the wake starts a new one.
+    link.upAt = 0;
+    link.service();
+    IS_EQUAL(link.scanJoins, 2);
+    link.disconnect();
+    link.service();
+    IS_EQUAL(link.scanJoins, 3);
+    END_IT
+}
+
+int test_connect_blocks() {
+    IT("connect() still waits for the AP, for setup()");
+    FakeLink link;
+    link.upAt = millis() + 2000;
+    link.connect();
+    IS_TRUE(millis() >= link.upAt);
+    IS_TRUE(link.service());
+    IS_EQUAL(link.scanJoins, 1);
+    END_IT
+}
+
+
+int main()
+{
+    SUITE("FastConnect");
+    test_join_nonblocking();
+    test_join_cached();
+    test_join_fallback();
+    test_rejoin();
+    test_connect_blocks();
+
+    FINISH
+}
@@ -0,0 +1,200 @@
+#include "FlowMeter.h"
+#include "BDDTest.h"
+#include "trace.h"
+
+#include <stdlib.h>
+#include <vector>
+
+static std::vector<FlowEvent> events;
+
+static void collect(const FlowEvent& e) {
+    events.push_back(e);
+}
+
+// millis() and micros() for the synthetic trains; micros() starts just
+// short of its wrap so every test crosses it.
+struct Clock {
+    uint64_t us;
+    uint32_t ms() const { return (uint32_t)(us / 1000); }
+    uint32_t micros() const { return (uint32_t)(us + 0xFFF00000UL); }
+};
+
+// gpm for seconds from the clock's current time, with +-jitterUs of meter
+// jitter per pulse.
+static void flow(FlowMeter& meter, Clock& clock, double gpm, double seconds, int jitterUs = 0) {
+    double intervalUs = 60e6 / (gpm * FLOW_PULSES_PER_GALLON);
+    uint64_t end = clock.us + (uint64_t)(seconds * 1e6);
+    uint64_t next = clock.us + (uint64_t)intervalUs;
+    while (next <= end) {
+        int j = jitterUs ? (rand() % (2 * jitterUs + 1)) - jitterUs : 0;
+        clock.us = next + j;
+        meter.pulse(clock.ms(), clock.micros());
+        next += (uint64_t)intervalUs;
+    }
+    if (clock.us < end) clock.us = end;
+}
+
+static void idle(FlowMeter& meter, Clock& clock, double seconds) {
+    uint64_t end = clock.us + (uint64_t)(seconds * 1e6);
+    while (clock.us < end) {
+        clock.us += 1000000;
+        meter.tick(clock.ms());
+    }
+}
+
+static int countKind(FlowEventKind kind) {
+    int n = 0;
+    for (const FlowEvent& e : events) n += e.kind == kind;
+    return n;
+}
+
+
+int test_flow_rates() {
+    IT("reads steady flows from a running toilet to a full shower within 2 %");
+    double rates[] = { 0.1, 0.5, 1.0, 2.5, 5.0, 10.0 };
+    for (double gpm : rates) {
+        FlowMeter meter(nullptr);
+        Clock clock = { 1000000 };
+        flow(meter, clock, gpm, 60, 2000);
+        uint32_t m = meter.milliGpm(clock.ms(), clock.micros());
+        LOG("(" << gpm << " -> " << m / 1000.0 << ") ");
+        IS_TRUE(abs((int)m - (int)(gpm * 1000)) <= gpm * 20 + 1);
+    }
+    END_IT
+}
+
+int test_flow_low_flow_registers() {
+    IT("registers a 0.1 GPM trickle within seconds, not a quart later");
+    events.clear();
+    FlowMeter meter(collect);
+    Clock clock = { 1000000 };
+    // 0.1 GPM is one pulse every 3 s; the old code needed 50 (150 s).
+    flow(meter, clock, 0.1, 10);
+    IS_TRUE(meter.drawing());
+    IS_EQUAL(countKind(FLOW_DRAW_START), 1);
+    IS_TRUE(meter.milliGpm(clock.ms(), clock.micros()) > 90);
+    END_IT
+}
+
+int test_flow_decays_to_zero() {
+    IT("decays the rate once the tap closes and ends the draw with its volume");
+    events.clear();
+    FlowMeter meter(collect);
+    Clock clock = { 1000000 };
+    flow(meter, clock, 2.0, 30);
+    uint32_t before = meter.milliGpm(clock.ms(), clock.micros());
+    clock.us += 1000000;
+    // One second after the last pulse (which were 150 ms apart): <= 0.3 GPM.
+    IS_TRUE(meter.milliGpm(clock.ms(), clock.micros()) <= 300);
+    IS_TRUE(before > 1900);
+
+    idle(meter, clock, FLOW_DRAW_GAP_MS / 1000 + 1);
+    IS_EQUAL(meter.milliGpm(clock.ms(), clock.micros()), 0);
+    IS_FALSE(meter.drawing());
+    IS_EQUAL(countKind(FLOW_DRAW_END), 1);
+    const FlowEvent& end = events.back();
+    // 2 GPM for 30 s = 1 gallon, within a pulse.
+    IS_TRUE(abs((int)end.milliGallons - 1000) <= FLOW_MGAL_PER_PULSE);
+    IS_TRUE(end.durationMs > 29000 && end.durationMs <= 30000);
+    IS_TRUE(end.peakMilliGpm > 1900 && end.peakMilliGpm < 2100);
+    END_IT
+}
+
+int test_flow_stray_pulse() {
+    IT("does not report a stray pulse as a draw but still totals it");
+    events.clear();
+    FlowMeter meter(collect);
+    meter.setTotalPulses(1000);
+    meter.pulse(5000, 5000000);
+    meter.tick(5000 + FLOW_DRAW_GAP_MS);
+    IS_TRUE(events.empty());
+    IS_EQUAL(meter.totalPulses(), 1001);
+    END_IT
+}
+
+int test_flow_draws() {
+    IT("separates draws on gaps and totals every pulse");
+    events.clear();
+    FlowMeter meter(collect);
+    Clock clock = { 1000000 };
+    flow(meter, clock, 1.5, 60);       // sink
+    idle(meter, clock, 45);
+    flow(meter, clock, 2.2, 480, 3000);  // shower
+    idle(meter, clock, 600);
+    IS_EQUAL(countKind(FLOW_DRAW_START), 2);
+    IS_EQUAL(countKind(FLOW_DRAW_END), 2);
+    IS_EQUAL(countKind(FLOW_LEAK), 0);
+    uint32_t mgal = 0;
+    for (const FlowEvent& e : events) {
+        if (e.kind == FLOW_DRAW_END) mgal += e.milliGallons;
+    }
+    IS_EQUAL(mgal, meter.totalPulses() * FLOW_MGAL_PER_PULSE);
+    // 1.5 + 17.6 gallons.
+    IS_TRUE(abs((int)mgal - 19100) < 50);
+    END_IT
+}
+
+int test_flow_leak() {
+    IT("flags continuous low flow as a leak and clears it after a quiet gap");
+    events.clear();
+    FlowMeter meter(collect);
+    Clock clock = { 1000000 };
+    // A drip: one pulse every 40 s (~0.9 gal/h), with normal draws on top.
+    // Never FLOW_QUIET_MS without a pulse, so the leak fires at FLOW_LEAK_MS.
+    for (int i = 0; i < 200; i++) {
+        clock.us += 40000000;
+        meter.pulse(clock.ms(), clock.micros());
+        meter.tick(clock.ms());
+        if (i == 50) flow(meter, clock, 2.0, 20);
+    }
+    IS_TRUE(meter.leaking());
+    IS_EQUAL(countKind(FLOW_LEAK), 1);
+    // Drips are too far apart to count as a draw.
+    IS_EQUAL(countKind(FLOW_DRAW_START), 1);
+
+    const FlowEvent* leak = nullptr;
+    for (const FlowEvent& e : events) {
+        if (e.kind == FLOW_LEAK) leak = &e;
+    }
+    IS_TRUE(leak->durationMs >= FLOW_LEAK_MS && leak->durationMs < FLOW_LEAK_MS + 40000);
+
+    idle(meter, clock, FLOW_QUIET_MS / 1000 + 1);
+    IS_FALSE(meter.leaking());
+    IS_EQUAL(countKind(FLOW_LEAK_CLEAR), 1);
+    END_IT
+}
+
+int test_flow_no_leak_on_normal_day() {
+    IT("raises no leak on a normal day with quiet nights");
+    events.clear();
+    FlowMeter meter(collect);
+    Clock clock = { 1000000 };
+    srand(7);
+    for (int hour = 0; hour < 24; hour++) {
+        bool night = hour < 6;
+        for (int d = 0; d < (night ? 0 : 3); d++) {
+            flow(meter, clock, 0.5 + rand() % 40 / 10.0, 20 + rand() % 300, 2000);
+            idle(meter, clock, 300 + rand() % 600);
+        }
+        idle(meter, clock, night ? 3600 : 600);
+    }
+    IS_EQUAL(countKind(FLOW_LEAK), 0);
+    IS_EQUAL(countKind(FLOW_DRAW_START), 54);
+    IS_EQUAL(countKind(FLOW_DRAW_END), 54);
+    END_IT
+}
+
+
+int main()
+{
+    SUITE("FlowMeter");
+    test_flow_rates();
+    test_flow_low_flow_registers();
+    test_flow_decays_to_zero();
+    test_flow_stray_pulse();
+    test_flow_draws();
+    test_flow_leak();
+    test_flow_no_leak_on_normal_day();
+
+    FINISH
+}
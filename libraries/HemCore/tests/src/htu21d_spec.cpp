@@ -0,0 +1,157 @@
+#include "SparkFunHTU21D.h"
+#include "Wire.h"
+#include "BDDTest.h"
+#include "trace.h"
+
+#include <math.h>
+
+// The vendored SparkFun HTU21D library against a modelled sensor (FakeWire.h).
+
+static HTU21D htu;
+
+static void setUp() {
+    fakeHtu.reset();
+    htu = HTU21D();
+    htu.begin();
+}
+
+// loop() at 1 ms per pass until the measurement is no longer busy. Returns
+// the final poll() result; elapsed and polls are filled in.
+static byte runLoop(unsigned long& elapsed, int& polls) {
+    unsigned long start = millis();
+    byte result;
+    polls = 0;
+    while ((result = htu.poll()) == HTU21D_BUSY) {
+        polls++;
+        delay(1);
+    }
+    elapsed = millis() - start;
+    return result;
+}
+
+
+int test_htu_crc_model() {
+    IT("models the sensor's CRC from the datasheet examples");
+    IS_EQUAL(FakeHTU21D::crc(0xDC), 0x79);
+    IS_EQUAL(FakeHTU21D::crc(0x683A), 0x7C);
+    IS_EQUAL(FakeHTU21D::crc(0x4E85), 0x6B);
+    END_IT
+}
+
+int test_htu_pipelined_pair() {
+    IT("reads humidity then temperature back to back without blocking");
+    setUp();
+    unsigned long before = millis();
+    IS_TRUE(htu.startMeasurement());
+    IS_EQUAL(millis(), before);
+    IS_EQUAL(fakeHtu.lastCommand, TRIGGER_HUMD_MEASURE_NOHOLD);
+    IS_FALSE(htu.startTemperature());
+
+    unsigned long elapsed;
+    int polls;
+    IS_EQUAL(runLoop(elapsed, polls), HTU21D_READY);
+    IS_EQUAL(fakeHtu.triggers, 2);
+    IS_EQUAL(fakeHtu.lastCommand, TRIGGER_TEMP_MEASURE_NOHOLD);
+    // Never read before the deadline, never a second time.
+    IS_EQUAL(fakeHtu.reads, 2);
+    IS_EQUAL(fakeHtu.nacks, 0);
+    // 16 + 50 ms at full resolution, plus a loop pass each to notice.
+    LOG("(" << elapsed << " ms over " << polls << " polls, old code blocked 110) ");
+    IS_TRUE(elapsed >= 66 && elapsed <= 68);
+
+    IS_TRUE(fabs(htu.humidity() - 32.4) < 0.1);
+    IS_TRUE(fabs(htu.temperature() - 24.7) < 0.1);
+    // Reported once.
+    IS_EQUAL(htu.poll(), HTU21D_IDLE);
+    END_IT
+}
+
+int test_htu_resolution_deadlines() {
+    IT("shortens the deadlines with the resolution");
+    setUp();
+    htu.setResolution(0x81);  // 11 bit RH, 11 bit temperature
+    IS_EQUAL(fakeHtu.userRegister & 0x81, 0x81);
+    htu.startMeasurement();
+    unsigned long elapsed;
+    int polls;
+    IS_EQUAL(runLoop(elapsed, polls), HTU21D_READY);
+    IS_EQUAL(fakeHtu.nacks, 0);
+    IS_TRUE(elapsed >= 15 && elapsed <= 17);
+
+    // A sensor left at 8/12 bit by an earlier boot is picked up by begin().
+    fakeHtu.reset();
+    fakeHtu.userRegister = 0x03;
+    htu = HTU21D();
+    htu.begin();
+    htu.startMeasurement();
+    IS_EQUAL(runLoop(elapsed, polls), HTU21D_READY);
+    IS_EQUAL(fakeHtu.nacks, 0);
+    IS_TRUE(elapsed >= 16 && elapsed <= 18);
+    END_IT
+}
+
+int test_htu_slow_sensor() {
+    IT("retries a sensor that is still converting at the deadline");
+    setUp();
+    fakeHtu.extraMs = 5;
+    htu.startHumidity();
+    unsigned long elapsed;
+    int polls;
+    IS_EQUAL(runLoop(elapsed, polls), HTU21D_READY);
+    IS_TRUE(fakeHtu.nacks > 0);
+    IS_EQUAL(fakeHtu.reads, 1);
+    IS_TRUE(fabs(htu.humidity() - 32.4) < 0.1);
+    END_IT
+}
+
+int test_htu_errors() {
+    IT("reports a bad CRC as 999 and a vanished sensor as 998");
+    setUp();
+    fakeHtu.badCrc = true;
+    htu.startMeasurement();
+    unsigned long elapsed;
+    int polls;
+    IS_EQUAL(runLoop(elapsed, polls), HTU21D_ERROR);
+    IS_EQUAL(htu.humidity(), 999);
+    IS_EQUAL(htu.temperature(), 999);
+
+    // Gone after the trigger: NACKs until HTU21D_TIMEOUT_MS past the deadline.
+    setUp();
+    htu.startHumidity();
+    fakeHtu.present = false;
+    IS_EQUAL(runLoop(elapsed, polls), HTU21D_ERROR);
+    IS_EQUAL(htu.humidity(), 998);
+    IS_TRUE(elapsed > 16 + HTU21D_TIMEOUT_MS && elapsed <= 16 + HTU21D_TIMEOUT_MS + 2);
+
+    // Not there at all: nothing starts.
+    IS_FALSE(htu.startMeasurement());
+    IS_EQUAL(htu.poll(), HTU21D_IDLE);
+    IS_EQUAL(htu.readTemperature(), 998);
+    END_IT
+}
+
+int test_htu_blocking_calls() {
+    IT("keeps the blocking calls, waiting only for the conversion");
+    setUp();
+    unsigned long before = millis();
+    IS_TRUE(fabs(htu.readHumidity() - 32.4) < 0.1);
+    IS_TRUE(fabs(htu.readTemperature() - 24.7) < 0.1);
+    unsigned long elapsed = millis() - before;
+    LOG("(" << elapsed << " ms, was 110) ");
+    IS_TRUE(elapsed <= 68);
+    END_IT
+}
+
+
+int main()
+{
+    SUITE("HTU21D");
+    test_htu_crc_model();
+    test_htu_pipelined_pair();
+    test_htu_resolution_deadlines();
+    test_htu_slow_sensor();
+    test_htu_errors();
+    test_htu_blocking_calls();
+
+    FINISH
+}
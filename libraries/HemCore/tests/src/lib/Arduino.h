@@ -0,0 +1,76 @@
+#ifndef arduino_shim_h
+#define arduino_shim_h
+
+// Just enough of the ESP8266 Arduino core to build the vendored libraries
+// on the host. Pins are backed by FakeWire.h.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+
+using std::min;
+using std::max;
+
+typedef uint8_t byte;
+
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x00
+#define INPUT_PULLUP 0x02
+#define OUTPUT 0x01
+
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+
+#define ICACHE_RAM_ATTR
+#define PROGMEM
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#define pgm_read_word(p) (*(const uint16_t*)(p))
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define digitalPinToInterrupt(p) (p)
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+void attachInterrupt(uint8_t pin, void (*isr)(void), int mode);
+void detachInterrupt(uint8_t pin);
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void yield();
+
+// Arduino's String, on std::string; only what the vendored libraries use.
+class String {
+public:
+    String(const char* s = "") : _s(s) {}
+    String(const std::string& s) : _s(s) {}
+    String(int n) : _s(std::to_string(n)) {}
+    String(long n) : _s(std::to_string(n)) {}
+    String(unsigned long n) : _s(std::to_string(n)) {}
+
+    unsigned int length() const { return _s.size(); }
+    char charAt(unsigned int i) const { return i < _s.size() ? _s[i] : 0; }
+    String substring(unsigned int from) const { return substring(from, _s.size()); }
+    String substring(unsigned int from, unsigned int to) const {
+        if (from > _s.size()) from = _s.size();
+        if (to > _s.size()) to = _s.size();
+        return from < to ? String(_s.substr(from, to - from)) : String();
+    }
+    const char* c_str() const { return _s.c_str(); }
+    String& operator+=(char c) { _s += c; return *this; }
+    String& operator+=(const String& o) { _s += o._s; return *this; }
+    friend String operator+(const String& a, const String& b) { return String(a._s + b._s); }
+    bool operator==(const String& o) const { return _s == o._s; }
+    bool operator!=(const String& o) const { return _s != o._s; }
+
+private:
+    std::string _s;
+};
+
+#endif
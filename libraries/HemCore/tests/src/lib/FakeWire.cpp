@@ -0,0 +1,296 @@
+#include "Wire.h"
+#include "SPI.h"
+
+#include <map>
+
+TwoWire Wire;
+FakeExpander fakeExpander;
+FakeHTU21D fakeHtu;
+FakeSSD1306 fakeOled;
+SPIClass SPI;
+static unsigned long fakeMicros = 0;
+
+static std::map<uint8_t, uint8_t> pinLevels;
+static std::map<uint8_t, void (*)(void)> isrs;
+static unsigned long fakeMillis = 0;
+
+FakeExpander::FakeExpander() {
+    reset(0x20, 0);
+}
+
+void FakeExpander::reset(uint8_t addr, uint8_t pin) {
+    address = addr;
+    intPin = pin;
+    latch = 0xFF;
+    external = 0xFF;
+    intLow = false;
+    reads = 0;
+    writes = 0;
+    _seen = 0xFF;
+}
+
+uint8_t FakeExpander::pins() const {
+    return latch & external;
+}
+
+void FakeExpander::drive(uint8_t pin, bool low) {
+    if (low) {
+        external &= ~(1 << pin);
+    } else {
+        external |= 1 << pin;
+    }
+    setInt(pins() != _seen);
+}
+
+uint8_t FakeExpander::busRead() {
+    reads++;
+    _seen = pins();
+    setInt(false);
+    return _seen;
+}
+
+void FakeExpander::busWrite(uint8_t value) {
+    writes++;
+    latch = value;
+    _seen = pins();
+    setInt(false);
+}
+
+void FakeExpander::setInt(bool low) {
+    bool fell = low && !intLow;
+    intLow = low;
+    if (fell && isrs.count(intPin)) isrs[intPin]();
+}
+
+FakeHTU21D::FakeHTU21D() {
+    reset();
+}
+
+void FakeHTU21D::reset() {
+    address = 0x40;
+    // Datasheet example readings: 32.4 %RH (CRC 0x6B) and 24.7 C (CRC 0x7C).
+    rawHumidity = 0x4E85;
+    rawTemperature = 0x683A;
+    userRegister = 0x02;
+    extraMs = 0;
+    badCrc = false;
+    present = true;
+    triggers = reads = nacks = 0;
+    lastCommand = 0;
+    _converting = 0;
+    _readyAt = 0;
+    _userPointer = false;
+}
+
+unsigned long FakeHTU21D::conversionMs(uint8_t command) const {
+    static const uint8_t rh[4] = { 16, 3, 5, 8 };
+    static const uint8_t t[4] = { 50, 13, 25, 7 };
+    uint8_t index = ((userRegister >> 6) & 2) | (userRegister & 1);
+    return (command == 0xF5 ? rh[index] : t[index]) + extraMs;
+}
+
+uint8_t FakeHTU21D::crc(uint16_t value) {
+    // x^8 + x^5 + x^4 + 1, MSB first, initial 0.
+    uint8_t c = 0;
+    for (int i = 1; i >= 0; i--) {
+        c ^= (uint8_t)(value >> (8 * i));
+        for (int bit = 0; bit < 8; bit++) {
+            c = c & 0x80 ? (uint8_t)((c << 1) ^ 0x31) : (uint8_t)(c << 1);
+        }
+    }
+    return c;
+}
+
+bool FakeHTU21D::busWrite(const uint8_t* data, uint8_t count) {
+    if (!present || count == 0) return false;
+    lastCommand = data[0];
+    _userPointer = false;
+    switch (data[0]) {
+        case 0xF3:
+        case 0xF5:
+            triggers++;
+            _converting = data[0];
+            _readyAt = millis() + conversionMs(data[0]);
+            break;
+        case 0xE6:
+            if (count > 1) userRegister = data[1];
+            break;
+        case 0xE7:
+            _userPointer = true;
+            break;
+    }
+    return true;
+}
+
+uint8_t FakeHTU21D::busRead(uint8_t* data, uint8_t count) {
+    if (!present) return 0;
+    if (_userPointer) {
+        _userPointer = false;
+        data[0] = userRegister;
+        return 1;
+    }
+    if (!_converting || millis() < _readyAt || count < 3) {
+        nacks++;
+        return 0;
+    }
+    reads++;
+    uint16_t raw = _converting == 0xF5 ? rawHumidity : rawTemperature;
+    _converting = 0;
+    data[0] = raw >> 8;
+    data[1] = raw & 0xFF;
+    data[2] = crc(raw) ^ (badCrc ? 0x01 : 0);
+    return 3;
+}
+
+FakeSSD1306::FakeSSD1306() {
+    reset();
+}
+
+void FakeSSD1306::reset() {
+    address = 0x3C;
+    memset(ram, 0, sizeof(ram));
+    transfers = bytes = dataBytes = 0;
+    _pending = 0;
+    _argCount = 0;
+    _colFrom = _pageFrom = 0;
+    _colTo = 127;
+    _pageTo = 7;
+    _col = _page = 0;
+}
+
+// Arguments taken by the commands the driver sends.
+static uint8_t argsFor(uint8_t c) {
+    switch (c) {
+        case 0x21: case 0x22:
+            return 2;
+        case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3:
+        case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+void FakeSSD1306::command(uint8_t c) {
+    if (_pending) {
+        _args[_argCount++] = c;
+        if (_argCount < argsFor(_pending)) return;
+        if (_pending == 0x21) {
+            _colFrom = _col = _args[0] & 0x7F;
+            _colTo = _args[1] & 0x7F;
+        } else if (_pending == 0x22) {
+            _pageFrom = _page = _args[0] & 0x07;
+            _pageTo = _args[1] & 0x07;
+        }
+        _pending = 0;
+        return;
+    }
+    if (argsFor(c)) {
+        _pending = c;
+        _argCount = 0;
+    }
+}
+
+bool FakeSSD1306::busWrite(const uint8_t* data, uint8_t count) {
+    transfers++;
+    bytes += 1 + count;
+    if (count == 0) return true;
+    uint8_t control = data[0];
+    for (uint8_t i = 1; i < count; i++) {
+        if (control == 0x40) {
+            dataBytes++;
+            ram[_page * 128 + _col] = data[i];
+            if (_col++ == _colTo) {
+                _col = _colFrom;
+                _page = _page == _pageTo ? _pageFrom : _page + 1;
+            }
+        } else {
+            command(data[i]);
+            // 0x80: one command, then a new control byte.
+            if (control == 0x80 && i + 1 < count) control = data[++i];
+        }
+    }
+    return true;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t address, uint8_t quantity) {
+    _rxCount = _rxPos = 0;
+    if (quantity > sizeof(_rx)) return 0;
+    if (address == fakeExpander.address && quantity == 1) {
+        _rx[0] = fakeExpander.busRead();
+        _rxCount = 1;
+    } else if (address == fakeHtu.address) {
+        _rxCount = fakeHtu.busRead(_rx, quantity);
+    }
+    return _rxCount;
+}
+
+int TwoWire::available() {
+    return _rxCount - _rxPos;
+}
+
+int TwoWire::read() {
+    return _rxPos < _rxCount ? _rx[_rxPos++] : -1;
+}
+
+void TwoWire::beginTransmission(uint8_t address) {
+    _address = address;
+    _txCount = 0;
+}
+
+size_t TwoWire::write(uint8_t value) {
+    if (_txCount >= sizeof(_tx)) return 0;
+    _tx[_txCount++] = value;
+    return 1;
+}
+
+uint8_t TwoWire::endTransmission() {
+    // 2 = address NACK, as on the real Wire.
+    if (_address == fakeExpander.address) {
+        if (_txCount) fakeExpander.busWrite(_tx[_txCount - 1]);
+        return 0;
+    }
+    if (_address == fakeHtu.address) {
+        return fakeHtu.busWrite(_tx, _txCount) ? 0 : 2;
+    }
+    if (_address == fakeOled.address) {
+        return fakeOled.busWrite(_tx, _txCount) ? 0 : 2;
+    }
+    return 2;
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    if (!pinLevels.count(pin)) pinLevels[pin] = HIGH;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+    pinLevels[pin] = value;
+}
+
+int digitalRead(uint8_t pin) {
+    if (pin == fakeExpander.intPin) return fakeExpander.intLow ? LOW : HIGH;
+    return pinLevels.count(pin) ? pinLevels[pin] : HIGH;
+}
+
+void attachInterrupt(uint8_t pin, void (*isr)(void), int mode) {
+    isrs[pin] = isr;
+}
+
+void detachInterrupt(uint8_t pin) {
+    isrs.erase(pin);
+}
+
+unsigned long millis() {
+    return fakeMillis;
+}
+
+void delay(unsigned long ms) {
+    fakeMillis += ms;
+    fakeMicros += ms * 1000;
+}
+
+unsigned long micros() {
+    return fakeMicros;
+}
+
+void yield() {}
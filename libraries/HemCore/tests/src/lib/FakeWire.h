@@ -0,0 +1,109 @@
+#ifndef fake_wire_h
+#define fake_wire_h
+
+#include <stdint.h>
+
+// Devices on the host I2C bus.
+
+// A PCF8574. Pins are quasi-bidirectional: a pin reads
+// low if the latch drives it low or something outside pulls it low. /INT
+// (open drain, on a host GPIO) goes low when the pins stop matching what was
+// last read or written, and is released by the next read or write.
+class FakeExpander {
+public:
+    FakeExpander();
+
+    void reset(uint8_t address, uint8_t intPin);
+
+    // Something outside pulls pin low (or lets it go).
+    void drive(uint8_t pin, bool low);
+
+    uint8_t pins() const;
+
+    uint8_t address;
+    uint8_t intPin;
+    uint8_t latch;
+    uint8_t external;
+    bool intLow;
+    uint32_t reads;
+    uint32_t writes;
+
+    // Bus side, called by the Wire shim.
+    uint8_t busRead();
+    void busWrite(uint8_t value);
+
+private:
+    void setInt(bool low);
+    uint8_t _seen;
+};
+
+// An HTU21D in no-hold master mode. A triggered conversion takes the
+// datasheet maximum for the resolution (plus extraMs); until then the sensor
+// NACKs its read address. Results come back with the sensor's CRC.
+class FakeHTU21D {
+public:
+    FakeHTU21D();
+
+    void reset();
+
+    uint8_t address;
+    uint16_t rawHumidity;
+    uint16_t rawTemperature;
+    uint8_t userRegister;
+    unsigned long extraMs;
+    bool badCrc;
+    bool present;
+
+    // Bus traffic: commands written, reads answered, reads NACKed.
+    uint32_t triggers;
+    uint32_t reads;
+    uint32_t nacks;
+    uint8_t lastCommand;
+
+    unsigned long conversionMs(uint8_t command) const;
+    static uint8_t crc(uint16_t value);
+
+    // Bus side, called by the Wire shim.
+    bool busWrite(const uint8_t* data, uint8_t count);
+    uint8_t busRead(uint8_t* data, uint8_t count);
+
+private:
+    uint8_t _converting;
+    unsigned long _readyAt;
+    bool _userPointer;
+};
+
+// An SSD1306 in horizontal addressing mode. Keeps the display RAM, follows
+// COLUMNADDR/PAGEADDR windows and counts what went over the bus. Each
+// transfer starts with a control byte: 0x80 one command, 0x00 a command
+// stream, 0x40 data.
+class FakeSSD1306 {
+public:
+    FakeSSD1306();
+
+    void reset();
+
+    uint8_t address;
+    uint8_t ram[128 * 64 / 8];
+    uint32_t transfers;
+    uint32_t bytes;       // including the address byte of each transfer
+    uint32_t dataBytes;
+
+    // Bus side, called by the Wire shim.
+    bool busWrite(const uint8_t* data, uint8_t count);
+
+private:
+    void command(uint8_t c);
+
+    uint8_t _pending;     // command still waiting for arguments
+    uint8_t _args[2];
+    uint8_t _argCount;
+    uint8_t _colFrom, _colTo, _pageFrom, _pageTo;
+    uint8_t _col, _page;
+};
+
+extern FakeExpander fakeExpander;
+extern FakeSSD1306 fakeOled;
+extern FakeHTU21D fakeHtu;
+
+#endif
@@ -0,0 +1,43 @@
+#include "Replay.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+bool replay_load(const char* defaultPath, const char* envOverride, std::vector<ReplaySample>& out) {
+    const char* path = getenv(envOverride);
+    if (!path) path = defaultPath;
+
+    FILE* f = fopen(path, "rb");
+    if (!f) return false;
+    std::string text;
+    char chunk[65536];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) {
+        text.append(chunk, n);
+    }
+    fclose(f);
+
+    // The exports are [{"data":[[ts,val],[ts,val],...]}]; a full JSON parser
+    // is not needed to walk the pairs.
+    size_t pos = text.find("\"data\"");
+    if (pos == std::string::npos) return false;
+    pos = text.find('[', pos);
+    const char* p = text.c_str() + pos + 1;
+    out.clear();
+    while (*p) {
+        while (*p == ' ' || *p == ',' || *p == '\n') p++;
+        if (*p != '[') break;
+        char* end;
+        ReplaySample s;
+        s.ms = strtoll(p + 1, &end, 10);
+        p = end;
+        while (*p == ' ' || *p == ',') p++;
+        s.value = strtod(p, &end);
+        p = end;
+        while (*p && *p != ']') p++;
+        if (*p) p++;
+        out.push_back(s);
+    }
+    return !out.empty();
+}
@@ -0,0 +1,19 @@
+#ifndef replay_h
+#define replay_h
+
+#include <stdint.h>
+#include <vector>
+
+// One [timestamp_ms, value] pair from a falcon history export
+// (power.json / temp.json in the repository root).
+struct ReplaySample {
+    int64_t ms;
+    double value;
+};
+
+// Loads the first "data" series of a history export. The path can be
+// overridden with the given environment variable. Returns false if the
+// file is missing or has no samples.
+bool replay_load(const char* defaultPath, const char* envOverride, std::vector<ReplaySample>& out);
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef spi_shim_h
+#define spi_shim_h
+
+#include "Arduino.h"
+
+#define SPI_CLOCK_DIV2 0
+
+// Host SPI: nothing on the other end.
+class SPIClass {
+public:
+    void begin() {}
+    void setClockDivider(uint8_t) {}
+    uint8_t transfer(uint8_t) { return 0; }
+};
+
+extern SPIClass SPI;
+
+#endif
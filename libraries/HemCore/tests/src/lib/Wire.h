@@ -0,0 +1,32 @@
+#ifndef wire_shim_h
+#define wire_shim_h
+
+#include "Arduino.h"
+#include "FakeWire.h"
+
+// Host Wire: every transaction goes to the fake device at its address.
+class TwoWire {
+public:
+    void begin() {}
+    void begin(int sda, int scl) { (void)sda; (void)scl; }
+    void setClock(uint32_t hz) { (void)hz; }
+    uint8_t requestFrom(uint8_t address, uint8_t quantity);
+    int available();
+    int read();
+    void beginTransmission(uint8_t address);
+    size_t write(uint8_t value);
+    uint8_t endTransmission();
+
+private:
+    uint8_t _address = 0;
+    uint8_t _rx[4];
+    uint8_t _rxCount = 0;
+    uint8_t _rxPos = 0;
+    // BUFFER_LENGTH on the ESP8266.
+    uint8_t _tx[128];
+    uint8_t _txCount = 0;
+};
+
+extern TwoWire Wire;
+
+#endif
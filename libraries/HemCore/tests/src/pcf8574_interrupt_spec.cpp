@@ -0,0 +1,181 @@
+#include "PCF8574.h"
+#include "PCF8574OnPort.h"
+#include "Wire.h"
+#include "BDDTest.h"
+#include "trace.h"
+
+// The vendored PCF8574 library against a modelled expander (FakeWire.h).
+
+#define EXPANDER 0x20
+#define INT_PIN 12
+#define BUTTON 3
+#define DOOR 4
+#define LED 0
+
+PCF8574 expander;
+
+static int falls = 0, rises = 0, doorChanges = 0;
+static void onButtonFall() { falls++; }
+static void onButtonRise() { rises++; }
+static void onDoor() { doorChanges++; }
+
+ICACHE_RAM_ATTR static void onInt() {
+    expander.checkForInterrupt();
+}
+
+// Someone wired /INT but forgot to flag it in the ISR.
+ICACHE_RAM_ATTR static void onIntForgetful() {}
+
+static void setUp(void (*isr)(void)) {
+    fakeExpander.reset(EXPANDER, INT_PIN);
+    expander = PCF8574();
+    expander.begin(EXPANDER);
+    expander.pinMode(LED, OUTPUT);
+    expander.pinMode(BUTTON, INPUT_PULLUP);
+    expander.pinMode(DOOR, INPUT_PULLUP);
+    expander.enableInterrupt(INT_PIN, isr);
+    falls = rises = doorChanges = 0;
+}
+
+
+int test_no_polling() {
+    IT("serves reads from the last state while nothing changes");
+    setUp(onInt);
+    uint32_t reads = fakeExpander.reads;
+    for (int i = 0; i < 1000; i++) {
+        IS_EQUAL(expander.digitalRead(BUTTON), HIGH);
+        IS_FALSE(expander.update());
+    }
+    IS_EQUAL(fakeExpander.reads - reads, 0);
+
+    // Without interrupts every read is a bus read.
+    expander.disableInterrupt();
+    for (int i = 0; i < 1000; i++) expander.digitalRead(BUTTON);
+    IS_EQUAL(fakeExpander.reads - reads, 1000);
+    END_IT
+}
+
+int test_one_read_per_edge() {
+    IT("reads once after an edge and dispatches per-pin callbacks");
+    setUp(onInt);
+    expander.attachInterrupt(BUTTON, onButtonFall, FALLING);
+    uint32_t reads = fakeExpander.reads;
+
+    fakeExpander.drive(BUTTON, true);
+    IS_TRUE(fakeExpander.intLow);
+    // The ISR only flagged it; no bus traffic yet.
+    IS_EQUAL(fakeExpander.reads - reads, 0);
+    IS_TRUE(expander.update());
+    IS_EQUAL(fakeExpander.reads - reads, 1);
+    IS_FALSE(fakeExpander.intLow);
+    IS_EQUAL(falls, 1);
+    IS_EQUAL(expander.digitalRead(BUTTON), LOW);
+    IS_FALSE(expander.update());
+    IS_EQUAL(fakeExpander.reads - reads, 1);
+
+    expander.attachInterrupt(BUTTON, onButtonRise, RISING);
+    fakeExpander.drive(BUTTON, false);
+    expander.update();
+    IS_EQUAL(rises, 1);
+    IS_EQUAL(falls, 1);
+    IS_EQUAL(fakeExpander.reads - reads, 2);
+    END_IT
+}
+
+int test_coalesced_changes() {
+    IT("covers several pins that changed before loop() got to them with one read");
+    setUp(onInt);
+    expander.attachInterrupt(BUTTON, onButtonFall, FALLING);
+    expander.attachInterrupt(DOOR, onDoor, CHANGE);
+    uint32_t reads = fakeExpander.reads;
+    fakeExpander.drive(BUTTON, true);
+    fakeExpander.drive(DOOR, true);
+    expander.update();
+    IS_EQUAL(fakeExpander.reads - reads, 1);
+    IS_EQUAL(falls, 1);
+    IS_EQUAL(doorChanges, 1);
+    END_IT
+}
+
+int test_int_level_fallback() {
+    IT("still reads while /INT is held low even if no edge was flagged");
+    setUp(onIntForgetful);
+    expander.attachInterrupt(DOOR, onDoor, CHANGE);
+    fakeExpander.drive(DOOR, true);
+    IS_TRUE(expander.update());
+    IS_EQUAL(doorChanges, 1);
+    IS_FALSE(expander.update());
+    END_IT
+}
+
+int test_outputs_do_not_fire() {
+    IT("reads outputs back as written without a bus read or a callback");
+    setUp(onInt);
+    expander.attachInterrupt(LED, onDoor, CHANGE);
+    uint32_t reads = fakeExpander.reads;
+    expander.digitalWrite(LED, HIGH);
+    IS_EQUAL(expander.digitalRead(LED), HIGH);
+    expander.digitalWrite(LED, LOW);
+    IS_EQUAL(expander.digitalRead(LED), LOW);
+    IS_EQUAL(fakeExpander.reads - reads, 0);
+    IS_EQUAL(doorChanges, 0);
+    // The inputs kept their pull-ups through the writes.
+    IS_TRUE((fakeExpander.latch & (1 << BUTTON)) != 0);
+    END_IT
+}
+
+// A HemCore port on the modelled expander.
+class FakeWirePort : public PCF8574Port {
+public:
+    FakeWirePort() : PCF8574Port(EXPANDER) {}
+
+protected:
+    bool busWrite(uint8_t value) override {
+        fakeExpander.busWrite(value);
+        return true;
+    }
+    bool busRead(uint8_t& value) override {
+        value = fakeExpander.busRead();
+        return true;
+    }
+};
+
+int test_on_port() {
+    IT("shares a PCF8574Port's shadow and counter through PCF8574OnPort");
+    fakeExpander.reset(EXPANDER, INT_PIN);
+    FakeWirePort port;
+    PCF8574OnPort pins(port);
+    pins.begin();
+    pins.pinMode(LED, OUTPUT);
+    pins.pinMode(BUTTON, INPUT_PULLUP);
+
+    uint32_t writes = fakeExpander.writes;
+    uint32_t reads = fakeExpander.reads;
+    uint32_t tx = port.transactions();
+    pins.digitalWrite(LED, HIGH);
+    IS_EQUAL(port.shadow() & (1 << LED), 1 << LED);
+    IS_EQUAL(fakeExpander.writes - writes, 1);
+    // Same pattern again: the port keeps it off the bus.
+    pins.digitalWrite(LED, HIGH);
+    IS_EQUAL(fakeExpander.writes - writes, 1);
+    // Every bus transaction the library made went through the port.
+    IS_EQUAL(port.transactions() - tx, (fakeExpander.writes - writes) + (fakeExpander.reads - reads));
+
+    fakeExpander.drive(BUTTON, true);
+    IS_EQUAL(pins.digitalRead(BUTTON), LOW);
+    END_IT
+}
+
+
+int main()
+{
+    SUITE("PCF8574 interrupts");
+    test_no_polling();
+    test_one_read_per_edge();
+    test_coalesced_changes();
+    test_int_level_fallback();
+    test_outputs_do_not_fire();
+    test_on_port();
+
+    FINISH
+}
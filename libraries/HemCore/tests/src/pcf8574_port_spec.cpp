@@ -0,0 +1,145 @@
+#include "PCF8574Port.h"
+#include "BDDTest.h"
+#include "trace.h"
+
+#include <vector>
+
+// The chip: an 8-bit latch that reads back what was written, unless a test
+// flips it underneath.
+class FakePort : public PCF8574Port {
+public:
+    FakePort() : PCF8574Port(0x39), pins(0), fail(false) {}
+    uint8_t pins;
+    bool fail;
+    std::vector<uint8_t> writes;
+
+protected:
+    bool busWrite(uint8_t value) override {
+        if (fail) return false;
+        pins = value;
+        writes.push_back(value);
+        return true;
+    }
+    bool busRead(uint8_t& value) override {
+        if (fail) return false;
+        value = pins;
+        return true;
+    }
+};
+
+// hem_hvac's wiring; relays are active low.
+#define COOL 5
+#define FAN 6
+#define HEAT 7
+#define COOL_OVER 2
+#define FAN_OVER 3
+#define HEAT_OVER 4
+#define BIT(p) (1 << (p))
+
+
+int test_port_single_transaction() {
+    IT("switches a whole relay pattern in one write");
+    FakePort port;
+    port.begin();
+    uint32_t before = port.transactions();
+
+    // COOLON: compressor, fan and all three override relays on.
+    uint8_t mask = BIT(COOL) | BIT(FAN) | BIT(COOL_OVER) | BIT(FAN_OVER) | BIT(HEAT_OVER);
+    IS_TRUE(port.apply(mask, 0));
+    IS_EQUAL(port.transactions() - before, 1);
+    IS_EQUAL(port.writes.size(), 2);
+    IS_EQUAL(port.pins, (uint8_t)~mask);
+    // Heat (bit 7) and the unused pins kept their level.
+    IS_EQUAL(port.digitalRead(HEAT), 1);
+    IS_EQUAL(port.digitalRead(0), 1);
+    END_IT
+}
+
+int test_port_skips_noop() {
+    IT("does not touch the bus when nothing changes or for reads");
+    FakePort port;
+    port.begin();
+    port.digitalWrite(HEAT, 0);
+    uint32_t before = port.transactions();
+    IS_TRUE(port.digitalWrite(HEAT, 0));
+    IS_TRUE(port.apply(BIT(COOL), BIT(COOL)));
+    uint8_t relays = 0;
+    for (int i = 0; i < 6; i++) relays |= port.digitalRead(i + 2) << i;
+    IS_EQUAL(port.transactions(), before);
+    IS_EQUAL(relays, 0x1F);
+    END_IT
+}
+
+int test_port_counts_hvac_transitions() {
+    IT("cuts I2C transactions per hvac transition");
+    // Old gpioWrite(): one read plus one write per pin; the 15 s report did
+    // six gpioRead()s.
+    int oldCoolOn = 5 * 2, oldHeatOn = 4 * 2, oldReport = 6;
+
+    FakePort port;
+    port.begin();
+    uint32_t t0 = port.transactions();
+    port.apply(BIT(COOL) | BIT(FAN) | BIT(COOL_OVER) | BIT(FAN_OVER) | BIT(HEAT_OVER), 0);
+    uint32_t coolOn = port.transactions() - t0;
+    port.apply(BIT(COOL) | BIT(FAN) | BIT(COOL_OVER) | BIT(FAN_OVER) | BIT(HEAT_OVER), 0xFF);
+    t0 = port.transactions();
+    port.apply(BIT(HEAT) | BIT(COOL_OVER) | BIT(FAN_OVER) | BIT(HEAT_OVER), 0);
+    uint32_t heatOn = port.transactions() - t0;
+    t0 = port.transactions();
+    port.shadow();
+    uint32_t report = port.transactions() - t0;
+
+    LOG("(CoolOn " << oldCoolOn << " -> " << coolOn << ", HeatOn " << oldHeatOn << " -> " << heatOn
+        << ", report " << oldReport << " -> " << report << ") ");
+    IS_EQUAL(coolOn, 1);
+    IS_EQUAL(heatOn, 1);
+    IS_EQUAL(report, 0);
+    END_IT
+}
+
+int test_port_verify() {
+    IT("verifies periodically and rewrites a chip that lost its state");
+    FakePort port;
+    port.begin(0xFF);
+    port.digitalWrite(HEAT, 0);
+    IS_TRUE(port.service(PCF8574_VERIFY_MS));
+    uint32_t before = port.transactions();
+    IS_TRUE(port.service(PCF8574_VERIFY_MS + 1000));
+    IS_EQUAL(port.transactions(), before);
+
+    // Relay board browned out and came back all high.
+    port.pins = 0xFF;
+    IS_FALSE(port.service(2 * PCF8574_VERIFY_MS));
+    IS_EQUAL(port.mismatches(), 1);
+    IS_EQUAL(port.pins, port.shadow());
+    IS_EQUAL(port.digitalRead(HEAT), 0);
+    END_IT
+}
+
+int test_port_retries_after_error() {
+    IT("keeps the intended state after a bus error and retries it");
+    FakePort port;
+    port.begin();
+    port.fail = true;
+    IS_FALSE(port.digitalWrite(COOL, 0));
+    IS_EQUAL(port.errors(), 1);
+    IS_EQUAL(port.digitalRead(COOL), 0);
+    port.fail = false;
+    // Same state again is not a no-op after a failed write.
+    IS_TRUE(port.digitalWrite(COOL, 0));
+    IS_EQUAL(port.pins, port.shadow());
+    END_IT
+}
+
+
+int main()
+{
+    SUITE("PCF8574Port");
+    test_port_single_transaction();
+    test_port_skips_noop();
+    test_port_counts_hvac_transitions();
+    test_port_verify();
+    test_port_retries_after_error();
+
+    FINISH
+}
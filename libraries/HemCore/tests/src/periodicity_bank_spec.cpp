@@ -0,0 +1,134 @@
+#include "PeriodicityBank.h"
+#include "EnergyWindow.h"
+#include "BDDTest.h"
+#include "Replay.h"
+#include "trace.h"
+
+#include <chrono>
+#include <math.h>
+#include <vector>
+
+static PeriodicityBank* bankUnderTest;
+static uint32_t minutesFed;
+
+static void feedMinute(const EnergySummary& s) {
+    bankUnderTest->sample((int16_t)s.meanW);
+    minutesFed++;
+}
+
+static void addBands(PeriodicityBank& bank) {
+    bank.addBand("fridge", 11, 15, 24);
+    bank.addBand("heater", 50, 80, 8);
+}
+
+// On/off load: `watts` for duty*period minutes out of every period.
+static int16_t square(uint32_t minute, float period, float duty, int16_t watts) {
+    float phase = fmodf(minute / period, 1.0f);
+    return phase < duty ? watts : 0;
+}
+
+
+int test_periodicity_sine() {
+    IT("finds period and amplitude of a sine on top of a base load");
+    PeriodicityBank bank;
+    addBands(bank);
+    for (uint32_t m = 0; m < 2 * PERIODICITY_WINDOW; m++) {
+        IS_EQUAL(bank.ready(), m >= PERIODICITY_WINDOW);
+        bank.sample((int16_t)(1500 + 100 * sinf(6.2831853f * m / 13.0f)));
+    }
+    IS_TRUE(fabsf(bank.dominantPeriod(0) - 13.0f) < 0.3f);
+    IS_TRUE(fabsf(bank.amplitude(0) - 100) < 10);
+    // Nothing in the heater band, and the 1500 W base load must not leak in.
+    IS_TRUE(bank.amplitude(1) < 10);
+    END_IT
+}
+
+int test_periodicity_square() {
+    IT("tracks the space heater duty cycle and notices when it stops");
+    PeriodicityBank bank;
+    addBands(bank);
+    uint32_t m = 0;
+    for (; m < PERIODICITY_WINDOW + 60; m++) {
+        bank.sample(800 + square(m, 13, 0.4f, 167) + square(m, 62, 0.23f, 1020));
+    }
+    IS_TRUE(fabsf(bank.dominantPeriod(0) - 13.0f) < 0.5f);
+    IS_TRUE(fabsf(bank.dominantPeriod(1) - 62.0f) < 5.0f);
+    // Fundamental of a 23 % duty square wave: 2 * 1020 * sin(0.23 pi) / pi.
+    IS_TRUE(bank.amplitude(1) > 350);
+    float running = bank.amplitude(1);
+
+    // Heater dies; within one window the band has emptied out.
+    for (uint32_t end = m + PERIODICITY_WINDOW; m < end; m++) {
+        bank.sample(800 + square(m, 13, 0.4f, 167));
+    }
+    IS_TRUE(bank.amplitude(1) < running / 10);
+    IS_TRUE(fabsf(bank.dominantPeriod(0) - 13.0f) < 0.5f);
+    END_IT
+}
+
+int test_periodicity_drift() {
+    IT("stays in step with a direct DFT over many windows");
+    PeriodicityBank slid, fresh;
+    addBands(slid);
+    uint32_t m = 0;
+    for (; m < 20 * PERIODICITY_WINDOW + 123; m++) {
+        slid.sample(1000 + square(m, 61, 0.25f, 1020) + (int16_t)((m * 7919) % 300));
+    }
+    // Fill a second bank with just the last window, then add bands
+    // (addBand resyncs from the window directly).
+    for (uint32_t k = m - PERIODICITY_WINDOW; k < m; k++) {
+        fresh.sample(1000 + square(k, 61, 0.25f, 1020) + (int16_t)((k * 7919) % 300));
+    }
+    addBands(fresh);
+    for (uint8_t b = 0; b < 2; b++) {
+        IS_TRUE(fabsf(slid.amplitude(b) - fresh.amplitude(b)) < 1.0f);
+        IS_TRUE(slid.dominantPeriod(b) == fresh.dominantPeriod(b));
+    }
+    END_IT
+}
+
+int test_periodicity_replay() {
+    IT("replays power.json");
+    std::vector<ReplaySample> series;
+    if (!replay_load("../../../power.json", "POWER_JSON", series)) {
+        LOG("(power.json not found, skipped) ");
+        END_IT
+    }
+
+    PeriodicityBank bank;
+    addBands(bank);
+    bankUnderTest = &bank;
+    minutesFed = 0;
+    EnergyWindow minute(60000, feedMinute);
+
+    auto start = std::chrono::steady_clock::now();
+    uint64_t tUs = 0;
+    for (size_t i = 1; i < series.size(); i++) {
+        uint32_t intervalUs = (uint32_t)(3600000000.0 / series[i].value);
+        tUs += intervalUs;
+        minute.pulse((uint32_t)(tUs / 1000), intervalUs, (uint32_t)(series[i].value + 0.5));
+    }
+    double cppMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    LOG("(" << minutesFed << " min, C++ " << cppMs << " ms; fridge " << bank.dominantPeriod(0)
+        << " min/" << (int)bank.amplitude(0) << " W, heater " << bank.dominantPeriod(1)
+        << " min/" << (int)bank.amplitude(1) << " W");
+
+    LOG(") ");
+
+    IS_TRUE(bank.ready());
+    IS_TRUE(minutesFed > 2500);
+    END_IT
+}
+
+
+int main()
+{
+    SUITE("PeriodicityBank");
+    test_periodicity_sine();
+    test_periodicity_square();
+    test_periodicity_drift();
+    test_periodicity_replay();
+
+    FINISH
+}
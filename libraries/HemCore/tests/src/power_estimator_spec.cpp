@@ -0,0 +1,127 @@
+#include "PowerEstimator.h"
+#include "BDDTest.h"
+#include "Replay.h"
+#include "trace.h"
+
+#include <vector>
+
+
+int test_estimator_bound_decays() {
+    IT("decays the bound as 3600/elapsed and snaps back on a pulse");
+    PowerEstimator est;
+    IS_FALSE(est.valid());
+    IS_EQUAL(est.estimate(0), 0);
+
+    est.pulse(1000000, 1500);
+    IS_EQUAL(est.estimate(1000000), 1500);
+    // 1 s after the pulse: cannot be more than 3600 W, still reporting the measurement.
+    IS_EQUAL(est.bound(2000000), 3600);
+    IS_EQUAL(est.estimate(2000000), 1500);
+    // 24 s after: at most 150 W.
+    IS_EQUAL(est.estimate(25000000), 150);
+    IS_TRUE(est.decaying(25000000));
+
+    est.pulse(26000000, 140);
+    IS_EQUAL(est.estimate(26000000), 140);
+    IS_FALSE(est.decaying(26000000));
+    END_IT
+}
+
+int test_estimator_step_down_once() {
+    IT("reports a step-down once per gap, past the margin");
+    PowerEstimator est(10);
+    est.pulse(0, 1000);
+    // 3.6 s is exactly the previous interval: bound == measured.
+    IS_FALSE(est.checkStepDown(3600000));
+    // 3.9 s -> 923 W, inside the 10% margin.
+    IS_FALSE(est.checkStepDown(3900000));
+    // 4.1 s -> 878 W, outside it.
+    IS_TRUE(est.checkStepDown(4100000));
+    IS_FALSE(est.checkStepDown(9000000));
+
+    est.pulse(10000000, 360);
+    IS_FALSE(est.checkStepDown(10500000));
+    IS_TRUE(est.checkStepDown(30000000));
+    END_IT
+}
+
+int test_estimator_micros_wrap() {
+    IT("handles micros() wrap-around");
+    PowerEstimator est;
+    uint32_t start = 0xFFFFFF00UL;
+    est.pulse(start, 2000);
+    IS_EQUAL(est.bound(start + 3600000UL), 1000);
+    END_IT
+}
+
+int test_estimator_replay() {
+    IT("detects every real step-down in power.json before the next pulse");
+    std::vector<ReplaySample> series;
+    if (!replay_load("../../../power.json", "POWER_JSON", series)) {
+        LOG("(power.json not found, skipped) ");
+        END_IT
+    }
+
+    // Rebuild pulse times from the published watts (1 Wh per pulse), which
+    // is what the node itself saw; the history timestamps are broker
+    // receive times and carry network jitter.
+    const uint8_t margin = 5;
+    PowerEstimator est(margin);
+    uint32_t t = 0;
+    est.pulse(t, (uint32_t)series[0].value);
+
+    int steps = 0, detected = 0, falseAlarms = 0;
+    double leadSum = 0;
+    for (size_t i = 1; i < series.size(); i++) {
+        uint32_t prevW = est.measured();
+        uint32_t watts = (uint32_t)(series[i].value + 0.5);
+        uint32_t dt = (uint32_t)(3600000000.0 / series[i].value);
+        uint32_t next = t + dt;
+
+        // Poll the estimator every 100 ms like loop() would.
+        bool fired = false;
+        uint32_t firedAt = 0;
+        uint32_t lastBound = est.bound(t + 1);
+        for (uint32_t now = t + 100000; now - t < dt; now += 100000) {
+            uint32_t b = est.bound(now);
+            if (b > lastBound) return false; // bound must never grow between pulses
+            lastBound = b;
+            if (!fired && est.checkStepDown(now)) {
+                fired = true;
+                firedAt = now;
+            }
+        }
+
+        if (watts * 100 < prevW * 80) {
+            steps++;
+            if (fired) {
+                detected++;
+                leadSum += (next - firedAt) / 1e6;
+            }
+        } else if (watts * 100 >= prevW * 98 && fired) {
+            falseAlarms++;
+        }
+
+        est.pulse(next, watts);
+        IS_EQUAL(est.estimate(next), watts);
+        t = next;
+    }
+
+    LOG("(" << steps << " step-downs, mean lead " << (steps ? leadSum / steps : 0) << " s) ");
+    IS_TRUE(steps > 0);
+    IS_EQUAL(detected, steps);
+    IS_EQUAL(falseAlarms, 0);
+    END_IT
+}
+
+
+int main()
+{
+    SUITE("PowerEstimator");
+    test_estimator_bound_decays();
+    test_estimator_step_down_once();
+    test_estimator_micros_wrap();
+    test_estimator_replay();
+
+    FINISH
+}
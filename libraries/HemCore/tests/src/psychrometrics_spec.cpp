@@ -0,0 +1,174 @@
+#include "Psychrometrics.h"
+#include "BDDTest.h"
+#include "trace.h"
+
+#include <chrono>
+#include <math.h>
+#include <stdlib.h>
+
+// What hem_htu computed before, verbatim apart from the names.
+static double oldDewPoint(double celsius, double humidity) {
+    double a = 17.271;
+    double b = 237.7;
+    double temp = (a * celsius) / (b + celsius) + log(humidity * 0.01);
+    double Td = (b * temp) / (a - temp);
+    return Td;
+}
+
+static float oldFeelsLike(float tempC, float humidityRH) {
+    float vaporPressure = (humidityRH / 100.0) * 6.105 * exp((17.27 * tempC) / (237.7 + tempC));
+    float apparentTempC = tempC + (0.33 * vaporPressure) - 4.0;
+    return apparentTempC;
+}
+
+static double saturationHpa(double c) {
+    return 6.105 * exp(17.27 * c / (237.7 + c));
+}
+
+// Worst error of f(centiC, centiRh) - ref(c, rh) over the grid.
+template <typename F, typename R>
+static double worst(F f, R ref, int fromC, int toC, int fromRh, int toRh, double scale) {
+    double w = 0;
+    for (int c = fromC * 100; c <= toC * 100; c += 7) {
+        for (int rh = fromRh * 100; rh <= toRh * 100; rh += 13) {
+            double err = fabs(f(c, rh) / scale - ref(c / 100.0, rh / 100.0));
+            if (err > w) w = err;
+        }
+    }
+    return w;
+}
+
+
+int test_psychro_saturation() {
+    IT("interpolates saturation pressure within 0.15 % above -20 C, 0.2 Pa below");
+    double w = 0, cold = 0;
+    for (int c = -4000; c <= 6000; c++) {
+        double ref = saturationHpa(c / 100.0) * 1000;
+        double err = fabs(Psychrometrics::saturationPressure(c) - ref);
+        if (c < -2000) {
+            if (err > cold) cold = err;
+        } else if (err / ref > w) {
+            w = err / ref;
+        }
+    }
+    LOG("(" << w * 100 << " %, " << cold / 10 << " Pa) ");
+    IS_TRUE(w < 0.0015);
+    IS_TRUE(cold <= 2);
+    IS_EQUAL(Psychrometrics::saturationPressure(-6000), Psychrometrics::saturationPressure(-4000));
+    IS_EQUAL(Psychrometrics::saturationPressure(8000), Psychrometrics::saturationPressure(6000));
+    END_IT
+}
+
+int test_psychro_dew_point() {
+    IT("matches the old dew point within 0.03 C indoors, 0.05 C outdoors");
+    auto f = [](int c, int rh) { return (double)Psychrometrics::dewPoint(c, rh); };
+    // hem_htu only publishes between 7 and 32 C.
+    double indoor = worst(f, oldDewPoint, 7, 32, 5, 100, 100);
+    // Dew points below the table clamp; -20 C at 20 % is about -38 C.
+    double wide = worst(f, oldDewPoint, -20, 50, 20, 100, 100);
+    LOG("(7..32 C: " << indoor << " C, -20..50 C: " << wide << " C) ");
+    IS_TRUE(indoor < 0.03);
+    IS_TRUE(wide < 0.05);
+    // Saturated air is at its dew point.
+    IS_TRUE(abs(Psychrometrics::dewPoint(2150, 10000) - 2150) <= 1);
+    // Bone dry air clamps to the bottom of the table.
+    IS_EQUAL(Psychrometrics::dewPoint(2000, 0), PSYCHRO_MIN_C * 100);
+    END_IT
+}
+
+int test_psychro_apparent_temperature() {
+    IT("matches the old feels-like within 0.02 C");
+    auto f = [](int c, int rh) { return (double)Psychrometrics::apparentTemperature(c, rh); };
+    auto ref = [](double c, double rh) { return (double)oldFeelsLike(c, rh); };
+    double w = worst(f, ref, -20, 50, 0, 100, 100);
+    LOG("(" << w << " C) ");
+    IS_TRUE(w < 0.02);
+    END_IT
+}
+
+int test_psychro_absolute_humidity() {
+    IT("gives absolute humidity within 0.25 % or 2 mg/m3");
+    double w = 0;
+    for (int c = -2000; c <= 5000; c += 7) {
+        for (int rh = 0; rh <= 10000; rh += 13) {
+            double ref = 2166.8 * saturationHpa(c / 100.0) * rh / 100.0 / (c / 100.0 + 273.15);
+            double err = fabs(Psychrometrics::absoluteHumidity(c, rh) - ref);
+            double allowed = fmax(ref * 0.0025, 2);
+            if (err / allowed > w) w = err / allowed;
+        }
+    }
+    LOG("(" << w * 100 << " % of allowed) ");
+    IS_TRUE(w < 1);
+    // 21 C at 50 %: about 9.1 g/m3.
+    IS_TRUE(abs((int)Psychrometrics::absoluteHumidity(2100, 5000) - 9150) < 50);
+    END_IT
+}
+
+int test_psychro_enthalpy() {
+    IT("gives moist air enthalpy within 0.1 kJ/kg");
+    auto f = [](int c, int rh) { return (double)Psychrometrics::enthalpy(c, rh); };
+    auto ref = [](double c, double rh) {
+        double e = saturationHpa(c) * rh;  // Pa
+        double w = 0.622 * e / (101325 - e);
+        return 1.006 * c + w * (2501 + 1.86 * c);
+    };
+    double w = worst(f, ref, -20, 50, 0, 100, 1000);
+    LOG("(" << w << " kJ/kg) ");
+    IS_TRUE(w < 0.1);
+    // 24 C at 50 % is about 47.8 kJ/kg at sea level; less air, more vapour per kg.
+    IS_TRUE(abs(Psychrometrics::enthalpy(2400, 5000) - 47800) < 300);
+    IS_TRUE(Psychrometrics::enthalpy(2400, 5000, 84000) > Psychrometrics::enthalpy(2400, 5000));
+    END_IT
+}
+
+int test_psychro_cost() {
+    IT("stays a few table reads and integer divides per reading");
+    const int n = 1000000;
+    volatile double sinkD = 0;
+    volatile int32_t sinkI = 0;
+    srand(3);
+    static int16_t cs[1024];
+    static uint16_t rhs[1024];
+    for (int i = 0; i < 1024; i++) {
+        cs[i] = 700 + rand() % 2500;
+        rhs[i] = 2000 + rand() % 6000;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; i++) {
+        double c = cs[i & 1023] / 100.0, rh = rhs[i & 1023] / 100.0;
+        sinkD = sinkD + oldDewPoint(c, rh) + oldFeelsLike(c, rh);
+    }
+    double oldNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / n;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; i++) {
+        int16_t c = cs[i & 1023];
+        uint16_t rh = rhs[i & 1023];
+        sinkI = sinkI + Psychrometrics::dewPoint(c, rh) + Psychrometrics::apparentTemperature(c, rh);
+    }
+    double newNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / n;
+
+    // The host's FPU makes log() and exp() cheap, so the two are close here.
+    // The ESP8266 has no FPU: the old path is a soft-float double log() and
+    // a float exp() per reading, the new one is the same integer code as on
+    // the host. The bound only catches a regression (a search gone linear,
+    // float creeping back in).
+    LOG("(dew point + feels-like: " << oldNs << " -> " << newNs << " ns on host) ");
+    IS_TRUE(newNs < 100);
+    END_IT
+}
+
+
+int main()
+{
+    SUITE("Psychrometrics");
+    test_psychro_saturation();
+    test_psychro_dew_point();
+    test_psychro_apparent_temperature();
+    test_psychro_absolute_humidity();
+    test_psychro_enthalpy();
+    test_psychro_cost();
+
+    FINISH
+}
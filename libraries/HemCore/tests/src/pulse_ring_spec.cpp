@@ -0,0 +1,68 @@
+#include "PulseRing.h"
+#include "BDDTest.h"
+#include "trace.h"
+
+
+int test_pulse_ring_fifo() {
+    IT("returns pulses in the order they were pushed");
+    PulseRing<8> ring;
+    for (uint32_t i = 0; i < 5; i++) {
+        IS_TRUE(ring.push(1000 + i));
+    }
+    IS_EQUAL(ring.available(), 5);
+
+    uint32_t t;
+    for (uint32_t i = 0; i < 5; i++) {
+        IS_TRUE(ring.pop(t));
+        IS_EQUAL(t, 1000 + i);
+    }
+    IS_FALSE(ring.pop(t));
+    END_IT
+}
+
+int test_pulse_ring_overflow() {
+    IT("drops the newest pulse and counts overflows when full");
+    PulseRing<4> ring;
+    for (uint32_t i = 0; i < 6; i++) {
+        ring.push(i);
+    }
+    IS_EQUAL(ring.available(), 4);
+    IS_EQUAL(ring.overflows(), 2);
+
+    uint32_t t;
+    IS_TRUE(ring.pop(t));
+    IS_EQUAL(t, 0);
+    IS_TRUE(ring.push(99));
+
+    uint32_t expected[] = { 1, 2, 3, 99 };
+    for (int i = 0; i < 4; i++) {
+        IS_TRUE(ring.pop(t));
+        IS_EQUAL(t, expected[i]);
+    }
+    END_IT
+}
+
+int test_pulse_ring_wrap() {
+    IT("keeps working across 16-bit index wrap-around");
+    PulseRing<4> ring;
+    uint32_t t;
+    for (uint32_t i = 0; i < 70000; i++) {
+        IS_TRUE(ring.push(i));
+        IS_TRUE(ring.pop(t));
+        IS_EQUAL(t, i);
+    }
+    IS_EQUAL(ring.available(), 0);
+    IS_EQUAL(ring.overflows(), 0);
+    END_IT
+}
+
+
+int main()
+{
+    SUITE("PulseRing");
+    test_pulse_ring_fifo();
+    test_pulse_ring_overflow();
+    test_pulse_ring_wrap();
+
+    FINISH
+}
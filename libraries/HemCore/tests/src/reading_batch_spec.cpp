@@ -0,0 +1,66 @@
+#include "ReadingBatch.h"
+#include "BDDTest.h"
+#include "trace.h"
+
+#include <string.h>
+
+
+int test_batch_format() {
+    IT("formats readings oldest first with their age");
+    ReadingBatch<8> batch;
+    batch.push(1000, 0, 1500);
+    batch.push(61000, 1, -167);
+    char buf[64];
+    IS_EQUAL(batch.format(121000, buf, sizeof(buf)), 2);
+    IS_TRUE(strcmp(buf, "{\"now\":121000,\"r\":[[120,0,1500],[60,1,-167]]}") == 0);
+    batch.drop(2);
+    IS_EQUAL(batch.size(), 0);
+    IS_EQUAL(batch.format(121000, buf, sizeof(buf)), 0);
+    END_IT
+}
+
+int test_batch_chunks() {
+    IT("splits a large batch into chunks that fit the buffer");
+    ReadingBatch<64> batch;
+    for (uint32_t i = 0; i < 60; i++) {
+        batch.push(i * 60000, 0, 1000 + i);
+    }
+    char buf[128];
+    uint16_t total = 0, chunks = 0;
+    while (batch.size()) {
+        uint16_t n = batch.format(3600000, buf, sizeof(buf));
+        IS_TRUE(n > 0);
+        IS_TRUE(strlen(buf) < sizeof(buf));
+        IS_TRUE(buf[strlen(buf) - 1] == '}');
+        batch.drop(n);
+        total += n;
+        chunks++;
+    }
+    IS_EQUAL(total, 60);
+    IS_TRUE(chunks > 1);
+    END_IT
+}
+
+int test_batch_overwrite() {
+    IT("keeps the newest readings when full");
+    ReadingBatch<4> batch;
+    for (int32_t i = 0; i < 6; i++) {
+        batch.push(i, 0, i);
+    }
+    IS_EQUAL(batch.size(), 4);
+    IS_EQUAL(batch.dropped(), 2);
+    IS_EQUAL(batch.peek(0).value, 2);
+    IS_EQUAL(batch.peek(3).value, 5);
+    END_IT
+}
+
+
+int main()
+{
+    SUITE("ReadingBatch");
+    test_batch_format();
+    test_batch_chunks();
+    test_batch_overwrite();
+
+    FINISH
+}
@@ -0,0 +1,240 @@
+#include "SensorRegistry.h"
+#include "BDDTest.h"
+#include "Replay.h"
+#include "trace.h"
+
+#include <chrono>
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+// Count heap allocations so the per-cycle cost can be compared.
+static unsigned long allocations = 0;
+
+void* operator new(size_t n) {
+    allocations++;
+    void* p = malloc(n ? n : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+
+static const uint8_t ROMS[3][8] = {
+    { 0x28, 0x4a, 0x04, 0x6d, 0x4c, 0x20, 0x01, 0xa3 },
+    { 0x28, 0xff, 0x0c, 0x01, 0x00, 0x00, 0x00, 0x5b },
+    { 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+};
+
+// What the sketches did before, with std::string standing in for String:
+// "temp/" plus two digits per byte, one temporary per step.
+static std::string oldTopic(const uint8_t* addr) {
+    std::string address = "temp/";
+    for (uint8_t i = 0; i < 8; i++) {
+        if (addr[i] < 16) address = address + std::string("0");
+        char digits[3];
+        snprintf(digits, sizeof(digits), "%x", addr[i]);
+        address = address + std::string(digits);
+    }
+    return address;
+}
+
+
+int test_registry_topics() {
+    IT("formats the topic once, in the same form as before");
+    SensorRegistry reg("temp/", 0.2f, 300000);
+    for (int i = 0; i < 3; i++) IS_EQUAL(reg.add(ROMS[i]), i);
+    IS_EQUAL(reg.count(), 3);
+    IS_TRUE(strcmp(reg.topic(0), "temp/284a046d4c2001a3") == 0);
+    for (int i = 0; i < 3; i++) IS_TRUE(oldTopic(ROMS[i]) == reg.topic(i));
+    IS_TRUE(memcmp(reg.rom(1), ROMS[1], 8) == 0);
+    // Same ROM again is the same entry.
+    IS_EQUAL(reg.add(ROMS[1]), 1);
+    END_IT
+}
+
+int test_registry_deadband() {
+    IT("publishes on first read, past the deadband and at max age");
+    SensorRegistry reg("temp/", 0.2f, 300000);
+    reg.add(ROMS[0]);
+    IS_TRUE(reg.due(0, 62.0f, 0));
+    reg.published(0, 62.0f, 0);
+    IS_FALSE(reg.due(0, 62.1f, 15000));
+    IS_FALSE(reg.due(0, 61.9f, 15000));
+    IS_TRUE(reg.due(0, 62.3f, 15000));
+    IS_TRUE(reg.due(0, 61.7f, 15000));
+    IS_TRUE(reg.due(0, 62.0f, 300000));
+    END_IT
+}
+
+int test_registry_rediscovery() {
+    IT("keeps state for sensors that are still on the bus after a rescan");
+    SensorRegistry reg("temp/", 0.2f, 300000);
+    reg.add(ROMS[0]);
+    reg.add(ROMS[1]);
+    reg.published(1, 70.0f, 1000);
+
+    reg.beginDiscovery();
+    reg.add(ROMS[1]);
+    reg.add(ROMS[2]);
+    reg.endDiscovery();
+
+    IS_EQUAL(reg.count(), 2);
+    IS_TRUE(strcmp(reg.topic(0), "temp/28ff0c010000005b") == 0);
+    IS_FALSE(reg.due(0, 70.1f, 16000));
+    IS_TRUE(reg.due(1, 70.1f, 16000));
+    END_IT
+}
+
+int test_registry_full() {
+    IT("refuses sensors past SENSOR_REGISTRY_MAX");
+    SensorRegistry reg("temp/", 0.2f, 300000);
+    uint8_t rom[8] = { 0x28 };
+    for (int i = 0; i < SENSOR_REGISTRY_MAX; i++) {
+        rom[7] = i;
+        IS_EQUAL(reg.add(rom), i);
+    }
+    rom[7] = 0xEE;
+    IS_EQUAL(reg.add(rom), -1);
+    END_IT
+}
+
+// A DallasTemperature with the sensors in ROMS; absent ones read as
+// DEVICE_DISCONNECTED_F.
+struct FakeBus {
+    int present = 3;
+    float temps[3] = { 62.0f, 70.0f, 55.5f };
+    int searches = 0;
+
+    void begin() { searches++; }
+    uint8_t getDeviceCount() { return present; }
+    bool getAddress(uint8_t* addr, uint8_t i) {
+        if (i >= present) return false;
+        memcpy(addr, ROMS[i], 8);
+        return true;
+    }
+    float getTempF(const uint8_t* rom) {
+        for (int i = 0; i < present; i++) {
+            if (memcmp(rom, ROMS[i], 8) == 0) return temps[i];
+        }
+        return -196.6f;
+    }
+};
+
+static std::vector<std::string> publishedTopics;
+
+static void collect(const char* topic, float value) {
+    publishedTopics.push_back(topic);
+}
+
+int test_registry_bus() {
+    IT("rescans at boot, after rescanMs and after a failed read, and publishes what is due");
+    SensorRegistry reg("temp/", 0.2f, 300000, 60000);
+    FakeBus bus;
+    IS_TRUE(reg.rescan(bus, 0));
+    IS_EQUAL(reg.count(), 3);
+    IS_FALSE(reg.rescan(bus, 15000));
+
+    publishedTopics.clear();
+    reg.read(bus, 15000, collect);
+    IS_EQUAL(publishedTopics.size(), 3);
+    IS_TRUE(publishedTopics[1] == "temp/28ff0c010000005b");
+    publishedTopics.clear();
+    bus.temps[1] = 70.5f;
+    reg.read(bus, 30000, collect);
+    IS_EQUAL(publishedTopics.size(), 1);
+    IS_TRUE(publishedTopics[0] == "temp/28ff0c010000005b");
+
+    // Pulled the third sensor: the next cycle searches the bus again.
+    bus.present = 2;
+    reg.read(bus, 45000, collect);
+    IS_TRUE(reg.rescan(bus, 45001));
+    IS_EQUAL(reg.count(), 2);
+    IS_EQUAL(bus.searches, 2);
+    IS_FALSE(reg.rescan(bus, 60000));
+    IS_TRUE(reg.rescan(bus, 105002));
+    END_IT
+}
+
+int test_registry_cycle_cost() {
+    IT("cuts per-cycle allocations and publishes on temp.json");
+    SensorRegistry reg("temp/", 0.2f, 300000);
+    for (int i = 0; i < 3; i++) reg.add(ROMS[i]);
+    const int cycles = 10000;
+
+    // Old read loop body: build the topic, format the value.
+    unsigned long before = allocations;
+    size_t sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int c = 0; c < cycles; c++) {
+        for (int i = 0; i < 3; i++) {
+            std::string topic = oldTopic(ROMS[i]);
+            std::string value = std::to_string(62.0f + c * 0.01f);
+            sink += topic.size() + value.size();
+        }
+    }
+    double oldUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / cycles;
+    double oldAllocs = (double)(allocations - before) / cycles;
+
+    before = allocations;
+    start = std::chrono::steady_clock::now();
+    for (int c = 0; c < cycles; c++) {
+        for (uint8_t i = 0; i < reg.count(); i++) {
+            float v = 62.0f + c * 0.01f;
+            if (!reg.due(i, v, c * 15000)) continue;
+            char buf[16];
+            snprintf(buf, sizeof(buf), "%.2f", v);
+            sink += strlen(reg.topic(i)) + strlen(buf);
+            reg.published(i, v, c * 15000);
+        }
+    }
+    double newUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / cycles;
+    double newAllocs = (double)(allocations - before) / cycles;
+
+    LOG("(3 sensors: " << oldAllocs << " -> " << newAllocs << " allocs/cycle, "
+        << oldUs << " -> " << newUs << " us/cycle on host");
+    IS_TRUE(newAllocs == 0);
+    IS_TRUE(oldAllocs > 0);
+    IS_TRUE(sink > 0);
+
+    std::vector<ReplaySample> series;
+    if (replay_load("../../../temp.json", "TEMP_JSON", series)) {
+        SensorRegistry one("temp/", 0.2f, 300000);
+        one.add(ROMS[0]);
+        size_t sent = 0;
+        for (const ReplaySample& s : series) {
+            uint32_t now = (uint32_t)(s.ms - series[0].ms);
+            if (one.due(0, s.value, now)) {
+                one.published(0, s.value, now);
+                sent++;
+            }
+        }
+        LOG("; temp.json: " << sent << " of " << series.size() << " published");
+        IS_TRUE(sent < series.size() / 2);
+    }
+    LOG(") ");
+    END_IT
+}
+
+
+int main()
+{
+    SUITE("SensorRegistry");
+    test_registry_topics();
+    test_registry_deadband();
+    test_registry_rediscovery();
+    test_registry_full();
+    test_registry_bus();
+    test_registry_cycle_cost();
+
+    FINISH
+}
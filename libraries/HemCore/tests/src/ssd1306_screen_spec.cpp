@@ -0,0 +1,158 @@
+#include "SSD1306Widgets.h"
+#include "Wire.h"
+#include "BDDTest.h"
+#include "trace.h"
+
+#include <string.h>
+
+// The retained widgets and frame scheduler over the vendored SSD1306 driver,
+// against the modelled panel (FakeWire.h).
+
+static const char block[8 * 8 / 8] = {
+    (char)0xFF, (char)0x81, (char)0x81, (char)0x81, (char)0x81, (char)0x81, (char)0x81, (char)0xFF,
+};
+static const char* const icons[] = {NULL, block};
+
+static SSD1306 display(0x3C, 4, 5);
+static SSD1306Screen screen(&display);
+static SSD1306ValueWidget power(0, 0, 63, 19, ArialMT_Plain_16_Font, " W");
+static SSD1306ValueWidget temp(0, 19, 63, 19, ArialMT_Plain_16_Font, " F");
+static SSD1306IconWidget icon(64, 0, 8, 8, icons, 2);
+
+static void setUp() {
+    fakeOled.reset();
+    display = SSD1306(0x3C, 4, 5);
+    display.init();
+    screen = SSD1306Screen(&display);
+    power = SSD1306ValueWidget(0, 0, 63, 19, ArialMT_Plain_16_Font, " W");
+    temp = SSD1306ValueWidget(0, 19, 63, 19, ArialMT_Plain_16_Font, " F");
+    icon = SSD1306IconWidget(64, 0, 8, 8, icons, 2);
+    screen.add(&power);
+    screen.add(&temp);
+    screen.add(&icon);
+    screen.setTargetFPS(10);
+    // The blank first frame.
+    screen.update();
+    delay(100);
+}
+
+// What the panel would show if every value were drawn from scratch.
+static void expectedPanel(long p, long t, uint8_t i, uint8_t* out) {
+    SSD1306 fresh(0x3C, 4, 5);
+    fakeOled.reset();
+    fresh.init();
+    fresh.setFont(ArialMT_Plain_16_Font);
+    fresh.drawString(0, 0, String(p) + " W");
+    fresh.drawString(0, 19, String(t) + " F");
+    if (icons[i]) fresh.drawXbm(64, 0, 8, 8, icons[i]);
+    fresh.display();
+    memcpy(out, fakeOled.ram, sizeof(fakeOled.ram));
+}
+
+
+int test_screen_idle() {
+    IT("renders nothing while nothing changes");
+    setUp();
+    unsigned long frames = screen.getFrames();
+    uint32_t bytes = fakeOled.bytes;
+    for (int i = 0; i < 50; i++) {
+        IS_FALSE(screen.update());
+        delay(20);
+    }
+    // Setting the value it already has is not a change.
+    power.set(1234);
+    IS_TRUE(screen.update());
+    IS_FALSE(power.set(1234));
+    delay(100);
+    IS_FALSE(screen.update());
+    IS_EQUAL(screen.getFrames(), frames + 1);
+    IS_TRUE(fakeOled.bytes > bytes);
+    END_IT
+}
+
+int test_screen_burst() {
+    IT("folds a burst of retained messages into one frame");
+    setUp();
+    // After a reconnect: every retained topic inside one mqtt.loop().
+    unsigned long frames = screen.getFrames();
+    uint32_t bytes = fakeOled.bytes;
+    for (int i = 0; i < 20; i++) {
+        power.set(1200 + i);
+        temp.set(70 + i % 3);
+        icon.set(i & 1);
+    }
+    IS_TRUE(screen.update());
+    IS_FALSE(screen.update());
+    IS_EQUAL(screen.getFrames(), frames + 1);
+    LOG("(60 changes, 1 frame, " << fakeOled.bytes - bytes << " bytes) ");
+
+    uint8_t expected[sizeof(fakeOled.ram)];
+    uint8_t seen[sizeof(fakeOled.ram)];
+    memcpy(seen, fakeOled.ram, sizeof(seen));
+    expectedPanel(1219, 71, 1, expected);
+    IS_TRUE(memcmp(seen, expected, sizeof(seen)) == 0);
+    END_IT
+}
+
+int test_screen_rate() {
+    IT("bounds frames per second whatever the message rate");
+    setUp();
+    unsigned long frames = screen.getFrames();
+    // A message every 2 ms for 5 s, loop() in between.
+    for (int ms = 0; ms < 5000; ms += 2) {
+        power.set(ms);
+        screen.update();
+        delay(2);
+    }
+    unsigned long rendered = screen.getFrames() - frames;
+    LOG("(2500 changes, " << rendered << " frames in 5 s at 10 fps) ");
+    IS_TRUE(rendered >= 49 && rendered <= 51);
+
+    // A change right after a frame waits for the next, but gets out.
+    delay(100);
+    power.set(1);
+    IS_TRUE(screen.update());
+    power.set(99999);
+    IS_FALSE(screen.update());
+    delay(100);
+    IS_TRUE(screen.update());
+    IS_EQUAL(power.get(), 99999);
+    END_IT
+}
+
+int test_screen_invalidate() {
+    IT("redraws every widget after the display was used for something else");
+    setUp();
+    power.set(1234);
+    temp.set(71);
+    icon.set(1);
+    screen.update();
+    delay(100);
+
+    display.clear();
+    display.display();
+    IS_FALSE(screen.update());
+    screen.invalidate();
+    IS_TRUE(screen.update());
+
+    uint8_t expected[sizeof(fakeOled.ram)];
+    uint8_t seen[sizeof(fakeOled.ram)];
+    memcpy(seen, fakeOled.ram, sizeof(seen));
+    expectedPanel(1234, 71, 1, expected);
+    IS_TRUE(memcmp(seen, expected, sizeof(seen)) == 0);
+    // Out of range icons are ignored.
+    IS_FALSE(icon.set(2));
+    END_IT
+}
+
+
+int main()
+{
+    SUITE("SSD1306Screen");
+    test_screen_idle();
+    test_screen_burst();
+    test_screen_rate();
+    test_screen_invalidate();
+
+    FINISH
+}
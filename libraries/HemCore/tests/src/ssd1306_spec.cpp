@@ -0,0 +1,598 @@
+#include "SSD1306.h"
+#include "Wire.h"
+#include "BDDTest.h"
+#include "trace.h"
+
+#include <chrono>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// The vendored SSD1306 driver against a modelled panel (FakeWire.h).
+
+// The old display(): six single-command transfers, then 64 transfers of
+// 16 data bytes, each with its address and control byte.
+#define OLD_FRAME_BYTES (6 * 3 + 64 * 18)
+
+// 400 kHz, 9 clocks per byte.
+#define BUS_US(bytes) ((bytes) * 9 * 1000000UL / 400000)
+
+static SSD1306 display(0x3C, 4, 5);
+
+static void setUp() {
+    display.setFlushBudget(0);
+    fakeOled.reset();
+    display = SSD1306(0x3C, 4, 5);
+    display.init();
+    display.setFont(ArialMT_Plain_16_Font);
+}
+
+// Service the flush on the way, if any, to the end. Returns the frames sent.
+static int drain() {
+    int frames = 0;
+    while (display.isFlushing()) {
+        if (display.service()) frames++;
+    }
+    return frames;
+}
+
+// The panel holds exactly what a full flush of the buffer would put there.
+static bool panelMatchesBuffer() {
+    uint8_t seen[sizeof(fakeOled.ram)];
+    memcpy(seen, fakeOled.ram, sizeof(seen));
+    display.invalidate();
+    display.display();
+    drain();
+    return memcmp(seen, fakeOled.ram, sizeof(seen)) == 0;
+}
+
+// hem_test's screen: power and temperature on the left, an icon on the right.
+static void drawValue(int y, String text) {
+    display.setColor(BLACK);
+    display.fillRect(0, y, 63, 19);
+    display.setColor(WHITE);
+    display.drawString(0, y, text);
+}
+
+
+int test_oled_first_frame() {
+    IT("sends the whole frame once after init, then nothing while idle");
+    setUp();
+    uint32_t initBytes = display.getLastFlushBytes();
+    LOG("(full frame " << OLD_FRAME_BYTES << " -> " << initBytes << " bytes) ");
+    IS_TRUE(initBytes <= OLD_FRAME_BYTES);
+    IS_EQUAL(fakeOled.dataBytes, 1024);
+
+    uint32_t before = fakeOled.bytes;
+    display.display();
+    IS_EQUAL(fakeOled.bytes, before);
+    IS_EQUAL(display.getLastFlushBytes(), 0);
+
+    // Drawing what is already there changes nothing either.
+    display.setColor(BLACK);
+    display.fillRect(10, 10, 20, 20);
+    display.display();
+    IS_EQUAL(display.getLastFlushBytes(), 0);
+    END_IT
+}
+
+int test_oled_number_update() {
+    IT("sends a fraction of a frame to update one number");
+    setUp();
+    drawValue(0, "1234 W");
+    drawValue(19, "71 F");
+    display.display();
+
+    drawValue(0, "1236 W");
+    display.display();
+    uint32_t bytes = display.getLastFlushBytes();
+    LOG("(" << OLD_FRAME_BYTES << " -> " << bytes << " bytes, ~" << BUS_US(OLD_FRAME_BYTES) / 1000
+        << " -> ~" << BUS_US(bytes) / 1000.0 << " ms at 400 kHz) ");
+    IS_TRUE(bytes * 8 < OLD_FRAME_BYTES);
+    IS_TRUE(panelMatchesBuffer());
+    END_IT
+}
+
+int test_oled_redraw_all() {
+    IT("sends only the lit areas when the whole screen is cleared and redrawn");
+    setUp();
+    display.drawString(0, 0, "1234 W");
+    display.drawString(0, 19, "71 F");
+    display.fillRect(80, 8, 32, 48);
+    display.display();
+
+    // hem_test's old draw(): clear(), everything again, display().
+    display.clear();
+    display.drawString(0, 0, "1236 W");
+    display.drawString(0, 19, "71 F");
+    display.fillRect(80, 8, 32, 48);
+    display.display();
+    uint32_t bytes = display.getLastFlushBytes();
+    LOG("(" << OLD_FRAME_BYTES << " -> " << bytes << " bytes) ");
+    IS_TRUE(bytes < OLD_FRAME_BYTES * 2 / 3);
+    IS_TRUE(panelMatchesBuffer());
+    END_IT
+}
+
+int test_oled_windows_merge() {
+    IT("sends text spanning pages as one window");
+    setUp();
+    uint32_t transfers = fakeOled.transfers;
+    display.drawString(0, 0, "88");  // 19 px high: pages 0-2
+    display.display();
+    uint32_t bytes = display.getLastFlushBytes();
+    // One command transfer, the rest data.
+    IS_EQUAL(fakeOled.transfers - transfers, 1 + (fakeOled.dataBytes - 1024 + 15) / 16);
+    IS_TRUE(bytes < 100);
+    IS_TRUE(panelMatchesBuffer());
+    END_IT
+}
+
+int test_oled_random_drawing() {
+    IT("keeps the panel equal to the buffer through any mix of drawing");
+    setUp();
+    srand(5);
+    bool ok = true;
+    for (int frame = 0; frame < 200; frame++) {
+        int ops = 1 + rand() % 6;
+        for (int i = 0; i < ops; i++) {
+            display.setColor(rand() % 3);
+            switch (rand() % 5) {
+                case 0: display.setPixel(rand() % 140 - 6, rand() % 76 - 6); break;
+                case 1: display.fillRect(rand() % 128, rand() % 64, rand() % 40, rand() % 20); break;
+                case 2: display.drawRect(rand() % 128, rand() % 64, rand() % 40, rand() % 20); break;
+                case 3: display.drawString(rand() % 128, rand() % 64, String(rand() % 1000)); break;
+                case 4: if (rand() % 8 == 0) display.clear(); break;
+            }
+        }
+        display.display();
+        ok = ok && panelMatchesBuffer();
+    }
+    IS_TRUE(ok);
+    END_IT
+}
+
+// Glyphs first..first+count-1 of the extended ascii set as utf8.
+static String glyphRun(int first, int count) {
+    String s;
+    for (int c = first; c < first + count && c < 256; c++) {
+        if (c >= 0x80) {
+            s += (char)(c < 0xC0 ? 0xC2 : 0xC3);
+            s += (char)(c < 0xC0 ? c : (c & 0x3F) | 0x80);
+        } else {
+            s += (char)c;
+        }
+    }
+    return s;
+}
+
+// What the panel shows after drawing text on a half lit screen, through the
+// font's column index or the old pixel path.
+static void renderText(const SSD1306Font& font, bool indexed, int color, int align,
+                       int x, int y, const String& text, uint8_t* out) {
+    setUp();
+    display.fillRect(0, 20, 128, 24);
+    if (indexed) display.setFont(font);
+    else display.setFont(font.data);
+    display.setColor(color);
+    display.setTextAlignment(align);
+    display.drawString(x, y, text);
+    display.display();
+    memcpy(out, fakeOled.ram, sizeof(fakeOled.ram));
+}
+
+int test_oled_indexed_font_pixels() {
+    IT("draws every glyph of the indexed fonts exactly as the pixel path");
+    const SSD1306Font* fonts[] = {&ArialMT_Plain_10_Font, &ArialMT_Plain_16_Font, &ArialMT_Plain_24_Font};
+    uint8_t expected[sizeof(fakeOled.ram)], seen[sizeof(fakeOled.ram)];
+    srand(7);
+    int renders = 0, mismatches = 0, stale = 0;
+    for (const SSD1306Font* font : fonts) {
+        for (int first = 0x20; first < 0x100; first += 6) {
+            String text = glyphRun(first, 6);
+            for (int i = 0; i < 4; i++) {
+                // Unaligned and clipped at every edge, in every color.
+                int x = rand() % 160 - 16, y = rand() % 80 - 16;
+                int color = rand() % 3, align = rand() % 3;
+                renderText(*font, false, color, align, x, y, text, expected);
+                renderText(*font, true, color, align, x, y, text, seen);
+                if (memcmp(expected, seen, sizeof(seen)) != 0) mismatches++;
+                if (!panelMatchesBuffer()) stale++;
+                renders++;
+            }
+        }
+    }
+    LOG("(" << renders << " strings) ");
+    IS_EQUAL(mismatches, 0);
+    IS_EQUAL(stale, 0);
+    // Widths agree, so alignment does.
+    display.setFont(ArialMT_Plain_16);
+    int width = display.getStringWidth("1234 W \xC3\xA4");
+    display.setFont(ArialMT_Plain_16_Font);
+    IS_EQUAL(display.getStringWidth("1234 W \xC3\xA4"), width);
+    END_IT
+}
+
+// The old drawString(), verbatim apart from reaching the font through a
+// parameter: a utf8 copy of the text, a walk over every preceding width per
+// glyph, and setPixel() per bit.
+static void oldDrawString(const char* myFontData, int x, int y, String text) {
+  text = display.utf8ascii(text);
+  unsigned char currentByte;
+  int charX, charY;
+  int currentBitCount;
+  int charCode;
+  int currentCharWidth;
+  int currentCharStartPos;
+  int cursorX = 0;
+  int numberOfChars = pgm_read_byte(myFontData + CHAR_NUM_POS);
+  int charHeight = pgm_read_byte(myFontData + HEIGHT_POS);
+  int currentCharByteNum = 0;
+  int startX = x;
+  int startY = y;
+
+  for (int j=0; j < text.length(); j++) {
+    charCode = text.charAt(j)-0x20;
+    currentCharWidth = pgm_read_byte(myFontData + CHAR_WIDTH_START_POS + charCode);
+    currentCharStartPos = CHAR_WIDTH_START_POS + numberOfChars;
+    for (int m = 0; m < charCode; m++) {
+      currentCharStartPos += pgm_read_byte(myFontData + CHAR_WIDTH_START_POS + m)  * charHeight / 8 + 1;
+    }
+    currentCharByteNum = ((charHeight * currentCharWidth) / 8) + 1;
+    for (int i = 0; i < currentCharByteNum; i++) {
+      currentByte = pgm_read_byte(myFontData + currentCharStartPos + i);
+      for(int bit = 0; bit < 8; bit++) {
+         currentBitCount = i * 8 + bit;
+         charX = currentBitCount % currentCharWidth;
+         charY = currentBitCount / currentCharWidth;
+         if (bitRead(currentByte, bit)) {
+          display.setPixel(startX + cursorX + charX, startY + charY);
+         }
+      }
+      yield();
+    }
+    cursorX += currentCharWidth;
+  }
+}
+
+// Microseconds per string for hem_test's two lines and a line of 10 px text.
+static double textMicros(bool indexed) {
+    const int n = 200;
+    const String power("1234 W"), temp("71 F"), line("Lorem ipsum dolor sit amet");
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; i++) {
+        display.setColor(i & 1 ? BLACK : WHITE);
+        if (indexed) {
+            display.setFont(ArialMT_Plain_16_Font);
+            display.drawString(0, 0, power);
+            display.drawString(0, 19, temp);
+            display.setFont(ArialMT_Plain_10_Font);
+            display.drawString(0, 40, line);
+        } else {
+            oldDrawString(ArialMT_Plain_16, 0, 0, power);
+            oldDrawString(ArialMT_Plain_16, 0, 19, temp);
+            oldDrawString(ArialMT_Plain_10, 0, 40, line);
+        }
+    }
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / (n * 3);
+}
+
+int test_oled_text_speed() {
+    IT("draws text from the paged glyphs with the old renderer's pixels");
+    // Best of short alternating runs, so both see the same machine.
+    setUp();
+    double pixels = 1e9, columns = 1e9;
+    for (int run = 0; run < 50; run++) {
+        pixels = fmin(pixels, textMicros(false));
+        columns = fmin(columns, textMicros(true));
+    }
+    LOG("(" << pixels << " -> " << columns << " us per string on host, x" << pixels / columns
+        << ", short of the x10 target) ");
+    // The target was x10; it measures about x7 here. Only a floor well
+    // under that is asserted, as wall-clock ratios vary between machines.
+    IS_TRUE(pixels / columns > 4);
+    // Same pixels as the old renderer too.
+    uint8_t expected[sizeof(fakeOled.ram)];
+    setUp();
+    oldDrawString(ArialMT_Plain_16, 3, 5, "1234 W");
+    display.invalidate();
+    display.display();
+    memcpy(expected, fakeOled.ram, sizeof(expected));
+    setUp();
+    display.drawString(3, 5, "1234 W");
+    display.invalidate();
+    display.display();
+    IS_TRUE(memcmp(expected, fakeOled.ram, sizeof(expected)) == 0);
+    END_IT
+}
+
+int test_oled_async_flush() {
+    IT("returns from display() at once with a budget and sends the frame over service()");
+    setUp();
+    IS_TRUE(display.setFlushBudget(64));
+    drawValue(0, "1234 W");
+    drawValue(19, "71 F");
+    display.fillRect(80, 8, 32, 48);
+    uint32_t before = fakeOled.bytes;
+    display.display();
+    IS_EQUAL(fakeOled.bytes, before);
+    IS_TRUE(display.isFlushing());
+
+    int calls = 0, frames = 0;
+    uint32_t most = 0;
+    while (display.isFlushing()) {
+        uint32_t at = fakeOled.bytes;
+        if (display.service()) frames++;
+        most = max(most, fakeOled.bytes - at);
+        calls++;
+    }
+    LOG("(" << display.getLastFlushBytes() << " bytes over " << calls << " calls, at most " << most
+        << " bytes, ~" << BUS_US(most) << " us at 400 kHz) ");
+    IS_EQUAL(frames, 1);
+    IS_TRUE(most <= 64);
+    IS_TRUE(calls > 1);
+    IS_EQUAL(fakeOled.bytes - before, display.getLastFlushBytes());
+    // Idle again: nothing to send.
+    IS_FALSE(display.service());
+    IS_EQUAL(fakeOled.bytes - before, display.getLastFlushBytes());
+    IS_TRUE(panelMatchesBuffer());
+    END_IT
+}
+
+int test_oled_async_snapshot() {
+    IT("sends the frame as it was at display() while drawing goes on");
+    uint8_t expected[sizeof(fakeOled.ram)];
+    setUp();
+    drawValue(0, "1234 W");
+    display.display();
+    memcpy(expected, fakeOled.ram, sizeof(expected));
+
+    setUp();
+    display.setFlushBudget(40);
+    drawValue(0, "1234 W");
+    display.display();
+    display.service();
+    drawValue(0, "5678 W");
+    display.fillRect(0, 40, 128, 8);
+    IS_EQUAL(drain(), 1);
+    IS_TRUE(memcmp(expected, fakeOled.ram, sizeof(expected)) == 0);
+    // The later drawing goes with the next display().
+    display.display();
+    IS_EQUAL(drain(), 1);
+    IS_TRUE(panelMatchesBuffer());
+    END_IT
+}
+
+int test_oled_async_pending() {
+    IT("sends display() calls made during a flush as one frame after it");
+    setUp();
+    display.setFlushBudget(64);
+    drawValue(0, "1234 W");
+    display.display();
+    display.service();
+    for (int i = 0; i < 5; i++) {
+        drawValue(19, String(70 + i) + " F");
+        display.display();
+        display.service();
+    }
+    IS_EQUAL(drain(), 1);
+    IS_FALSE(display.isFlushing());
+    IS_TRUE(panelMatchesBuffer());
+    END_IT
+}
+
+int test_oled_async_queued_snapshot() {
+    IT("sends a display() made during a flush as it was at that call");
+    uint8_t expected[sizeof(fakeOled.ram)];
+    setUp();
+    drawValue(0, "1234 W");
+    drawValue(19, "71 F");
+    display.display();
+    memcpy(expected, fakeOled.ram, sizeof(expected));
+
+    setUp();
+    display.setFlushBudget(40);
+    drawValue(0, "1234 W");
+    display.display();
+    display.service();
+    drawValue(19, "71 F");
+    display.display();
+    // Drawn after the queued display(), before service() takes it.
+    drawValue(19, "99 F");
+    display.fillRect(0, 40, 128, 8);
+    IS_EQUAL(drain(), 2);
+    IS_TRUE(memcmp(expected, fakeOled.ram, sizeof(expected)) == 0);
+    display.display();
+    IS_EQUAL(drain(), 1);
+    IS_TRUE(panelMatchesBuffer());
+    END_IT
+}
+
+int test_oled_async_random() {
+    IT("keeps the panel equal to the buffer with drawing between service() calls");
+    setUp();
+    srand(11);
+    bool ok = true;
+    for (int frame = 0; frame < 200; frame++) {
+        display.setFlushBudget(rand() % 3 == 0 ? 0 : 1 + rand() % 100);
+        int ops = 1 + rand() % 6;
+        for (int i = 0; i < ops; i++) {
+            display.setColor(rand() % 3);
+            switch (rand() % 4) {
+                case 0: display.fillRect(rand() % 128, rand() % 64, rand() % 40, rand() % 20); break;
+                case 1: display.drawString(rand() % 128, rand() % 64, String(rand() % 1000)); break;
+                case 2: display.display(); break;
+                case 3: display.service(); break;
+            }
+        }
+        display.display();
+        for (int i = rand() % 4; i > 0; i--) display.service();
+        if (rand() % 2) {
+            drain();
+            ok = ok && panelMatchesBuffer();
+        }
+    }
+    drain();
+    ok = ok && panelMatchesBuffer();
+    IS_TRUE(ok);
+    // Back to blocking, nothing left behind.
+    display.setFlushBudget(0);
+    drawValue(0, "42 W");
+    display.display();
+    IS_FALSE(display.isFlushing());
+    IS_TRUE(panelMatchesBuffer());
+    END_IT
+}
+
+// The old per-pixel drawRect(), fillRect(), drawXbm() and drawBitmap(),
+// verbatim apart from reaching the display through a global.
+static void oldDrawRect(int x, int y, int width, int height) {
+  for (int i = x; i < x + width; i++) {
+    display.setPixel(i, y);
+    display.setPixel(i, y + height);
+  }
+  for (int i = y; i < y + height; i++) {
+    display.setPixel(x, i);
+    display.setPixel(x + width, i);
+  }
+}
+
+static void oldFillRect(int x, int y, int width, int height) {
+  for (int i = x; i < x + width; i++) {
+    for (int j = y; j < y + height; j++) {
+      display.setPixel(i, j);
+    }
+  }
+}
+
+static void oldDrawXbm(int x, int y, int width, int height, const char *xbm) {
+  if (width % 8 != 0) {
+    width =  ((width / 8) + 1) * 8;
+  }
+  for (int i = 0; i < width * height / 8; i++ ){
+    unsigned char charColumn = pgm_read_byte(xbm + i);
+    for (int j = 0; j < 8; j++) {
+      int targetX = (i * 8 + j) % width + x;
+      int targetY = (8 * i / (width)) + y;
+      if (bitRead(charColumn, j)) {
+        display.setPixel(targetX, targetY);
+      }
+    }
+  }
+}
+
+static void oldDrawBitmap(int x, int y, int width, int height, const char *bitmap) {
+  for (int i = 0; i < width * height / 8; i++ ){
+    unsigned char charColumn = 255 - pgm_read_byte(bitmap + i);
+    for (int j = 0; j < 8; j++) {
+      int targetX = i % width + x;
+      int targetY = (i / (width)) * 8 + j + y;
+      if (bitRead(charColumn, j)) {
+        display.setPixel(targetX, targetY);
+      }
+    }
+  }
+}
+
+static char randomImage[64 * 64 / 8];
+
+// One random shape through the old or the new code, on a cluttered screen.
+static void renderShape(bool old, int seed, uint8_t* out) {
+    setUp();
+    srand(seed);
+    for (int i = 0; i < 6; i++) {
+        display.setColor(rand() % 3);
+        display.fillRect(rand() % 128, rand() % 64, rand() % 64, rand() % 32);
+    }
+    display.display();
+    display.setColor(rand() % 3);
+    int x = rand() % 160 - 32, y = rand() % 96 - 32;
+    int width = rand() % 64 + 1, height = rand() % 64 + 1;
+    if (rand() % 4 == 0) height = rand() % 3;
+    switch (rand() % 4) {
+        case 0: old ? oldFillRect(x, y, width, height) : display.fillRect(x, y, width, height); break;
+        case 1: old ? oldDrawRect(x, y, width, height) : display.drawRect(x, y, width, height); break;
+        case 2: old ? oldDrawXbm(x, y, width, height, randomImage) : display.drawXbm(x, y, width, height, randomImage); break;
+        case 3: old ? oldDrawBitmap(x, y, width, height, randomImage) : display.drawBitmap(x, y, width, height, randomImage); break;
+    }
+    display.display();
+    memcpy(out, fakeOled.ram, sizeof(fakeOled.ram));
+}
+
+int test_oled_blit_pixels() {
+    IT("fills, frames and draws bitmaps exactly as the per-pixel code");
+    uint8_t expected[sizeof(fakeOled.ram)], seen[sizeof(fakeOled.ram)];
+    srand(13);
+    for (size_t i = 0; i < sizeof(randomImage); i++) randomImage[i] = rand() & rand();
+    int mismatches = 0, stale = 0;
+    for (int seed = 0; seed < 2000; seed++) {
+        renderShape(true, seed, expected);
+        renderShape(false, seed, seen);
+        if (memcmp(expected, seen, sizeof(seen)) != 0) mismatches++;
+        if (!panelMatchesBuffer()) stale++;
+    }
+    IS_EQUAL(mismatches, 0);
+    IS_EQUAL(stale, 0);
+    END_IT
+}
+
+// hem_test's icon: a 64x64 XBM with about a third of its bits lit.
+static char icon[64 * 64 / 8];
+
+// Microseconds per hem_test widget redraw: clear the value's rectangle and
+// the icon's, draw the icon.
+static double blitMicros(bool old) {
+    const int n = 100;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; i++) {
+        display.setColor(BLACK);
+        if (old) {
+            oldFillRect(0, 0, 63, 19);
+            oldFillRect(63, 0, 64, 64);
+        } else {
+            display.fillRect(0, 0, 63, 19);
+            display.fillRect(63, 0, 64, 64);
+        }
+        display.setColor(WHITE);
+        if (old) oldDrawXbm(63, 0, 64, 64, icon);
+        else display.drawXbm(63, 0, 64, 64, icon);
+    }
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / n;
+}
+
+int test_oled_blit_speed() {
+    IT("times hem_test's rectangle and icon redraw, a byte at a time against per pixel");
+    srand(17);
+    for (size_t i = 0; i < sizeof(icon); i++) icon[i] = rand() & (rand() | rand());
+    setUp();
+    double pixels = 1e9, bytes = 1e9;
+    for (int run = 0; run < 30; run++) {
+        pixels = fmin(pixels, blitMicros(true));
+        bytes = fmin(bytes, blitMicros(false));
+    }
+    // Logged only; the pixels are checked above.
+    LOG("(" << pixels << " -> " << bytes << " us on host, x" << pixels / bytes << ") ");
+    END_IT
+}
+
+
+int main()
+{
+    SUITE("SSD1306");
+    test_oled_first_frame();
+    test_oled_number_update();
+    test_oled_redraw_all();
+    test_oled_windows_merge();
+    test_oled_random_drawing();
+    test_oled_indexed_font_pixels();
+    test_oled_text_speed();
+    test_oled_async_flush();
+    test_oled_async_snapshot();
+    test_oled_async_pending();
+    test_oled_async_queued_snapshot();
+    test_oled_async_random();
+    test_oled_blit_pixels();
+    test_oled_blit_speed();
+
+    FINISH
+}
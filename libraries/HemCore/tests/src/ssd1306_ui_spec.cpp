@@ -0,0 +1,185 @@
+#include "SSD1306Ui.h"
+#include "Wire.h"
+#include "BDDTest.h"
+#include "trace.h"
+
+#include <string.h>
+
+// SSD1306Ui's frame engine over the vendored SSD1306 driver, against the
+// modelled panel (FakeWire.h) on the shim's clock.
+
+static SSD1306 display(0x3C, 4, 5);
+static SSD1306Ui ui(&display);
+
+// Milliseconds each frame callback takes, on the shim's clock.
+static unsigned long frameCost = 0;
+
+// A clock-like frame that asks to be redrawn every tick.
+static bool clockFrame(SSD1306* d, SSD1306UiState* state, int x, int y) {
+    delay(frameCost);
+    d->setFont(ArialMT_Plain_16_Font);
+    d->drawString(x + 10, y + 10, "12:34");
+    d->fillRect(x + 10, y + 30, 100, 8);
+    return true;
+}
+
+static bool iconFrame(SSD1306* d, SSD1306UiState* state, int x, int y) {
+    delay(frameCost);
+    d->drawRect(x + 40, y + 8, 48, 40);
+    return false;
+}
+
+static FrameCallback frames[] = {clockFrame, iconFrame};
+
+static void setUp(bool autoTransition) {
+    display.setFlushBudget(0);
+    display.setFrameDiff(false);
+    fakeOled.reset();
+    frameCost = 0;
+    display = SSD1306(0x3C, 4, 5);
+    ui = SSD1306Ui(&display);
+    ui.setTargetFPS(30);
+    ui.setFrames(frames, 2);
+    ui.setTimePerFrame(1000);
+    ui.setTimePerTransition(500);
+    if (!autoTransition) ui.disableAutoTransition();
+    ui.init();
+    ui.resetStats();
+}
+
+// Call update() every millisecond for ms milliseconds.
+static void run(unsigned long ms) {
+    for (unsigned long i = 0; i < ms; i++) {
+        ui.update();
+        delay(1);
+    }
+}
+
+// The panel holds exactly what a full flush of the buffer would put there.
+static bool panelMatchesBuffer() {
+    while (display.isFlushing()) display.service();
+    uint8_t seen[sizeof(fakeOled.ram)];
+    memcpy(seen, fakeOled.ram, sizeof(seen));
+    display.invalidate();
+    display.display();
+    while (display.isFlushing()) display.service();
+    return memcmp(seen, fakeOled.ram, sizeof(seen)) == 0;
+}
+
+
+int test_ui_frame_diff() {
+    IT("sends nothing for frames redrawn the same");
+    setUp(false);
+    run(100);
+    unsigned long first = ui.getStats().bytes;
+    ui.resetStats();
+    run(1000);
+    const SSD1306UiStats& stats = ui.getStats();
+    LOG("(" << stats.frames << " frames, " << first << " bytes for the first, " << stats.bytes << " after) ");
+    IS_TRUE(stats.frames >= 29);
+    IS_EQUAL(stats.bytes, 0);
+    IS_TRUE(panelMatchesBuffer());
+
+    // Without the diff every redraw sends what is lit.
+    display.setFrameDiff(false);
+    ui.resetStats();
+    run(1000);
+    IS_TRUE(ui.getStats().bytes > 100 * ui.getStats().frames);
+    END_IT
+}
+
+int test_ui_transition_bytes() {
+    IT("sends only the changed bytes of each transition frame");
+    setUp(true);
+    run(1000);
+    ui.resetStats();
+    run(600);
+    const SSD1306UiStats& stats = ui.getStats();
+    LOG("(" << stats.bytes / stats.frames << " bytes per frame) ");
+    IS_EQUAL(ui.getUiState().currentFrame, 1);
+    IS_TRUE(stats.bytes / stats.frames < 1170);
+    IS_TRUE(panelMatchesBuffer());
+    END_IT
+}
+
+// How long the transition from frame 0 takes with frames costing cost ms.
+static unsigned long transitionMillis(unsigned long cost) {
+    setUp(true);
+    frameCost = cost;
+    while (ui.getUiState().frameState != IN_TRANSITION) run(1);
+    unsigned long start = millis();
+    while (ui.getUiState().frameState == IN_TRANSITION) run(1);
+    return millis() - start;
+}
+
+int test_ui_transition_time() {
+    IT("keeps transitions to their time by dropping frames when frames are slow");
+    unsigned long fast = transitionMillis(0);
+    unsigned long slow = transitionMillis(40);
+    const SSD1306UiStats& stats = ui.getStats();
+    LOG("(500 ms: " << fast << " ms at 0 ms per frame, " << slow << " ms at 40 ms, "
+        << stats.dropped << " steps dropped) ");
+    IS_TRUE(fast >= 450 && fast <= 550);
+    // A frame costs 40 ms, and the one that finds the transition over has to
+    // be waited for.
+    IS_TRUE(slow >= 450 && slow <= 550 + 80);
+    IS_TRUE(stats.dropped > 0);
+    END_IT
+}
+
+int test_ui_frame_budget() {
+    IT("spaces slow frames to keep to the frame budget, and records their times");
+    setUp(false);
+    frameCost = 40;
+    ui.setFrameBudget(50);
+    run(100);
+    ui.resetStats();
+    run(4000);
+    const SSD1306UiStats& stats = ui.getStats();
+    LOG("(" << ui.getFPS() << " fps at 40 ms per frame) ");
+    // 40 ms is half of 80 ms.
+    IS_TRUE(ui.getFPS() > 11 && ui.getFPS() < 13.5);
+    IS_EQUAL(stats.histogram[6], stats.frames);
+    IS_EQUAL(stats.micros / stats.frames / 1000, 40);
+
+    frameCost = 0;
+    run(200);
+    ui.resetStats();
+    run(1000);
+    LOG("(" << ui.getFPS() << " fps at 0 ms) ");
+    IS_TRUE(ui.getFPS() >= 29);
+    IS_EQUAL(ui.getStats().histogram[0], ui.getStats().frames);
+    END_IT
+}
+
+int test_ui_async() {
+    IT("drops frames instead of waiting for a flush spread over update() calls");
+    setUp(true);
+    display.setFlushBudget(20);
+    ui.resetStats();
+    // One update() per 10 ms: a transition frame takes several to go out.
+    unsigned long bytes = fakeOled.bytes;
+    for (int i = 0; i < 200; i++) {
+        ui.update();
+        delay(10);
+    }
+    const SSD1306UiStats& stats = ui.getStats();
+    LOG("(" << stats.frames << " frames, " << stats.dropped << " dropped) ");
+    IS_TRUE(stats.dropped > 0);
+    IS_TRUE(stats.bytes <= fakeOled.bytes - bytes);
+    IS_TRUE(panelMatchesBuffer());
+    END_IT
+}
+
+
+int main()
+{
+    SUITE("SSD1306Ui");
+    test_ui_frame_diff();
+    test_ui_transition_bytes();
+    test_ui_transition_time();
+    test_ui_frame_budget();
+    test_ui_async();
+
+    FINISH
+}
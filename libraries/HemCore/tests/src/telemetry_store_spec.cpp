@@ -0,0 +1,249 @@
+#include "TelemetryStore.h"
+#include "BDDTest.h"
+#include "Replay.h"
+#include "trace.h"
+
+#include <chrono>
+#include <deque>
+#include <math.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+// In-memory stand-in for LittleFSSpill.
+class MemorySpill : public TelemetrySpill {
+public:
+    explicit MemorySpill(uint32_t max) : _max(max) {}
+    bool push(const uint8_t* block) override {
+        if (_blocks.size() >= _max) return false;
+        _blocks.push_back(std::vector<uint8_t>(block, block + TELEMETRY_BLOCK_SIZE));
+        return true;
+    }
+    bool peek(uint8_t* block) override {
+        if (_blocks.empty()) return false;
+        memcpy(block, _blocks.front().data(), TELEMETRY_BLOCK_SIZE);
+        return true;
+    }
+    void drop() override { _blocks.pop_front(); }
+    uint32_t count() const override { return _blocks.size(); }
+
+private:
+    uint32_t _max;
+    std::deque<std::vector<uint8_t> > _blocks;
+};
+
+struct Replayed {
+    std::string topic;
+    uint32_t t;
+    float value;
+};
+
+static std::vector<Replayed> replayed;
+static int acceptBudget = -1;
+
+static bool collect(const char* topic, uint32_t tSec, float value, uint8_t decimals) {
+    if (acceptBudget == 0) return false;
+    if (acceptBudget > 0) acceptBudget--;
+    replayed.push_back({ topic, tSec, value });
+    return true;
+}
+
+static void drain(TelemetryStore& store) {
+    while (!store.empty()) {
+        if (!store.replay(collect, 4) && !store.empty() && acceptBudget == 0) break;
+    }
+}
+
+
+int test_store_roundtrip() {
+    IT("replays interleaved series in order with original timestamps");
+    replayed.clear();
+    acceptBudget = -1;
+    TelemetryStore store;
+    int8_t a = store.series("temp/a", 2);
+    int8_t b = store.series("water/GPM", 2);
+    IS_EQUAL(store.series("temp/a", 2), a);
+
+    for (uint32_t i = 0; i < 500; i++) {
+        store.append(a, 1000 + i * 15 + (i % 3), 62.0f + (i % 17) * 0.01f);
+        if (i % 10 == 0) store.append(b, 1000 + i * 15, i * 0.25f);
+    }
+    IS_EQUAL(store.samples(), 550);
+    drain(store);
+    IS_EQUAL(replayed.size(), 550);
+    IS_TRUE(store.empty());
+
+    uint32_t i = 0;
+    for (const Replayed& r : replayed) {
+        if (r.topic == "temp/a") {
+            IS_EQUAL(r.t, 1000 + i * 15 + (i % 3));
+            IS_TRUE(fabsf(r.value - (62.0f + (i % 17) * 0.01f)) < 0.001f);
+            i++;
+        }
+    }
+    IS_EQUAL(i, 500);
+    END_IT
+}
+
+int test_store_large_jumps() {
+    IT("round-trips large timestamp gaps and value steps");
+    replayed.clear();
+    acceptBudget = -1;
+    TelemetryStore store;
+    int8_t p = store.series("power/1m", 0);
+    uint32_t t = 5;
+    float values[] = { 0, 4483, 4483, 167, -20000, 100000, 100001, 3 };
+    uint32_t gaps[] = { 0, 60, 60, 7200, 1, 100000, 60, 59 };
+    for (int k = 0; k < 8; k++) {
+        t += gaps[k];
+        store.append(p, t, values[k]);
+    }
+    drain(store);
+    IS_EQUAL(replayed.size(), 8);
+    t = 5;
+    for (int k = 0; k < 8; k++) {
+        t += gaps[k];
+        IS_EQUAL(replayed[k].t, t);
+        IS_TRUE(replayed[k].value == values[k]);
+    }
+    END_IT
+}
+
+int test_store_resumes() {
+    IT("offers a refused sample again on the next replay");
+    replayed.clear();
+    TelemetryStore store;
+    int8_t a = store.series("temp/a", 1);
+    for (uint32_t i = 0; i < 10; i++) store.append(a, i, i);
+
+    acceptBudget = 4;
+    IS_EQUAL(store.replay(collect), 4);
+    IS_FALSE(store.empty());
+    acceptBudget = -1;
+    drain(store);
+    IS_EQUAL(replayed.size(), 10);
+    for (uint32_t i = 0; i < 10; i++) IS_EQUAL(replayed[i].t, i);
+    END_IT
+}
+
+// The broker, up while brokerUp is set.
+static std::vector<std::pair<std::string, std::string> > sent;
+static bool brokerUp = false;
+
+static bool publish(const char* topic, const char* payload) {
+    if (!brokerUp) return false;
+    sent.push_back({ topic, payload });
+    return true;
+}
+
+int test_store_publish() {
+    IT("publishes live readings, stores them while offline and replays them with their age");
+    sent.clear();
+    TelemetryStore store(nullptr, publish);
+
+    brokerUp = true;
+    store.publishOrStore("temp/tempF", 71.25, 2, 100);
+    IS_EQUAL(sent.size(), 1);
+    IS_TRUE(sent[0].first == "temp/tempF" && sent[0].second == "71.25");
+    IS_TRUE(store.empty());
+
+    brokerUp = false;
+    store.publishOrStore("temp/tempF", 71.5, 2, 115);
+    store.publishOrStore("temp/rh", 40.1, 1, 115);
+    IS_EQUAL(store.samples(), 2);
+    IS_EQUAL(store.publishReplay(130), 0);
+
+    // Back up: live readings queue behind the backlog so order is kept.
+    brokerUp = true;
+    store.publishOrStore("temp/tempF", 72, 2, 130);
+    IS_EQUAL(sent.size(), 1);
+    IS_EQUAL(store.publishReplay(145, 4), 3);
+    IS_TRUE(store.empty());
+    IS_EQUAL(sent.size(), 4);
+    IS_TRUE(sent[1].first == "replay/temp/tempF" && sent[1].second == "{\"age_s\":30,\"v\":71.50}");
+    IS_TRUE(sent[2].first == "replay/temp/rh" && sent[2].second == "{\"age_s\":30,\"v\":40.1}");
+    IS_TRUE(sent[3].first == "replay/temp/tempF" && sent[3].second == "{\"age_s\":15,\"v\":72.00}");
+    END_IT
+}
+
+int test_store_spill() {
+    IT("spills to the backing store when RAM fills and drops only past that");
+    replayed.clear();
+    acceptBudget = -1;
+    MemorySpill spill(4);
+    TelemetryStore store(&spill);
+    int8_t a = store.series("temp/a", 2);
+    uint32_t n = 0;
+    for (; spill.count() < 4; n++) store.append(a, n * 15, (n % 500) * 0.37f);
+    IS_EQUAL(store.dropped(), 0);
+    uint32_t held = store.samples();
+    IS_EQUAL(held, n);
+
+    // RAM and spill full: further blocks push the oldest RAM block out.
+    for (uint32_t k = 0; k < 2000; k++) store.append(a, (n + k) * 15, 1.0f);
+    IS_TRUE(store.dropped() > 0);
+    IS_EQUAL(store.samples() + store.dropped(), n + 2000);
+
+    drain(store);
+    IS_EQUAL(replayed.size(), n + 2000 - store.dropped());
+    for (size_t k = 1; k < replayed.size(); k++) IS_TRUE(replayed[k].t > replayed[k - 1].t);
+    END_IT
+}
+
+// Returns false if the replay lost samples; true (and logs) otherwise.
+static bool bench(const char* file, const char* env, const char* topic, uint8_t decimals) {
+    std::vector<ReplaySample> series;
+    if (!replay_load(file, env, series)) {
+        LOG(file << " not found, skipped. ");
+        return true;
+    }
+
+    // Big enough RAM-side spill to hold the whole capture.
+    MemorySpill spill(100000);
+    TelemetryStore store(&spill);
+    int8_t id = store.series(topic, decimals);
+    uint32_t t0 = (uint32_t)(series[0].ms / 1000);
+
+    auto start = std::chrono::steady_clock::now();
+    for (const ReplaySample& s : series) store.append(id, (uint32_t)(s.ms / 1000) - t0, (float)s.value);
+    double encodeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    uint32_t bytes = store.bytes();
+    double span = (series.back().ms - series.front().ms) / 3600000.0;
+
+    replayed.clear();
+    acceptBudget = -1;
+    start = std::chrono::steady_clock::now();
+    drain(store);
+    double replayMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    // 8 bytes raw (uint32 timestamp + float) per sample.
+    LOG(topic << ": " << series.size() << " samples in " << bytes << " B, "
+        << (8.0 * series.size() / bytes) << "x, " << (8.0 * bytes / series.size()) << " bit/sample, "
+        << (bytes / span) << " B/h; encode " << encodeMs << " ms, replay "
+        << (int)(series.size() / (replayMs / 1000)) << " samples/s. ");
+    return replayed.size() == series.size();
+}
+
+int test_store_benchmark() {
+    IT("compresses temp.json and power.json");
+    LOG("(");
+    IS_TRUE(bench("../../../temp.json", "TEMP_JSON", "temp/tempF", 2));
+    IS_TRUE(bench("../../../power.json", "POWER_JSON", "power/W", 2));
+    LOG(") ");
+    END_IT
+}
+
+
+int main()
+{
+    SUITE("TelemetryStore");
+    test_store_roundtrip();
+    test_store_large_jumps();
+    test_store_resumes();
+    test_store_publish();
+    test_store_spill();
+    test_store_benchmark();
+
+    FINISH
+}
@@ -18,15 +18,15 @@
 /* Dependencies */
 #include <Wire.h>
 #include "PCF8574.h"
-// #ifdef PCF8574_INTERRUPT_SUPPORT
-// #include "PCint.h"
-// #endif
+#if defined(PCF8574_INTERRUPT_SUPPORT) && defined(__AVR__)
+#include "PCint.h"
+#endif
 
 PCF8574::PCF8574() :
 		_PORT(0), _PIN(0), _DDR(0), _address(0)
-// #ifdef PCF8574_INTERRUPT_SUPPORT
-// 		, _oldPIN(0), _isrIgnore(0), _pcintPin(0), _intMode(), _intCallback()
-// #endif
+#ifdef PCF8574_INTERRUPT_SUPPORT
+		, _oldPIN(0), _intPending(0), _intEnabled(0), _pcintPin(0), _intMode(), _intCallback()
+#endif
 {
 }
 
@@ -79,14 +79,15 @@ void PCF8574::digitalWrite(uint8_t pin, uint8_t value) {
 
 uint8_t PCF8574::digitalRead(uint8_t pin) {
 
+#ifdef PCF8574_INTERRUPT_SUPPORT
+	/* Only read the bus if an input changed since the last read */
+	if (_intEnabled)
+		update();
+	else
+#endif
 	/* Read GPIO */
 	readGPIO();
 
-// #ifdef PCF8574_INTERRUPT_SUPPORT
-// 	/* Check for interrupt (manual detection) */
-// 	//checkForInterrupt();
-// #endif
-
 	/* Read and return the pin state */
 	return (_PIN & (1 << pin)) ? HIGH : LOW;
 }
@@ -102,14 +103,15 @@ void PCF8574::write(uint8_t value) {
 
 uint8_t PCF8574::read() {
 
+#ifdef PCF8574_INTERRUPT_SUPPORT
+	/* Only read the bus if an input changed since the last read */
+	if (_intEnabled)
+		update();
+	else
+#endif
 	/* Read GPIO */
 	readGPIO();
 
-// #ifdef PCF8574_INTERRUPT_SUPPORT
-// 	/* Check for interrupt (manual detection) */
-// 	//checkForInterrupt();
-// #endif
-
 	/* Return current pins values */
 	return _PIN;
 }
@@ -163,106 +165,111 @@ void PCF8574::blink(uint8_t pin, uint16_t count, uint32_t duration) {
 	}
 }
 
-// #ifdef PCF8574_INTERRUPT_SUPPORT
-// void PCF8574::enableInterrupt(uint8_t pin, void (*selfCheckFunction)(void)) {
-//
-// 	/* Store interrupt pin number */
-// 	_pcintPin = pin;
-//
-// 	/* Setup interrupt pin */
-// #if ARDUINO >= 100
-// 	::pinMode(pin, INPUT_PULLUP); // /!\ pinMode form THE ARDUINO CORE
-// #else
-// 	::pinMode(pin, INPUT); // /!\ pinMode form THE ARDUINO CORE
-// 	::digitalWrite(pin, HIGH); // /!\ digitalWrite form THE ARDUINO CORE
-// #endif
-//
-// 	/* Attach interrupt handler */
-// 	PCattachInterrupt(pin, selfCheckFunction, FALLING);
-// }
-//
-// void PCF8574::disableInterrupt() {
-//
-// 	/* Detach interrupt handler */
-// 	PCdetachInterrupt(_pcintPin);
-// }
-//
-// void PCF8574::checkForInterrupt() {
-//
-// 	/* Avoid nested interrupt triggered by I2C read/write */
-// 	if(_isrIgnore)
-// 		return;
-// 	else
-// 		_isrIgnore = 1;
-//
-// 	/* Re-enable interrupts to allow Wire library to work */
-// 	sei();
-//
-// 	/* Read current pins values */
-// 	readGPIO();
-//
-// 	/* Check all pins */
-// 	for (uint8_t i = 0; i < 8; ++i) {
-//
-// 		/* Check for interrupt handler */
-// 		if (!_intCallback[i])
-// 			continue;
-//
-// 		/* Check for interrupt event */
-// 		switch (_intMode[i]) {
-// 		case CHANGE:
-// 			if ((1 << i) & (_PIN ^ _oldPIN))
-// 				_intCallback[i]();
-// 			break;
-//
-// 		case LOW:
-// 			if (!(_PIN & (1 << i)))
-// 				_intCallback[i]();
-// 			break;
-//
-// 		case FALLING:
-// 			if ((_oldPIN & (1 << i)) && !(_PIN & (1 << i)))
-// 				_intCallback[i]();
-// 			break;
-//
-// 		case RISING:
-// 			if (!(_oldPIN & (1 << i)) && (_PIN & (1 << i)))
-// 				_intCallback[i]();
-// 			break;
-// 		}
-// 	}
-//
-// 	/* Turn off ISR ignore flag */
-// 	_isrIgnore = 0;
-// }
-//
-// void PCF8574::attachInterrupt(uint8_t pin, void (*userFunc)(void),
-// 		uint8_t mode) {
-//
-// 	/* Store interrupt mode and callback */
-// 	_intMode[pin] = mode;
-// 	_intCallback[pin] = userFunc;
-// }
-//
-// void PCF8574::detachInterrupt(uint8_t pin) {
-//
-// 	/* Void interrupt handler */
-// 	_intCallback[pin] = 0;
-// }
-// #endif
+#ifdef PCF8574_INTERRUPT_SUPPORT
+void PCF8574::enableInterrupt(uint8_t pin, void (*selfCheckFunction)(void)) {
 
-void PCF8574::readGPIO() {
+	/* Store interrupt pin number */
+	_pcintPin = pin;
 
-// #ifdef PCF8574_INTERRUPT_SUPPORT
-// 	/* Store old _PIN value */
-// 	_oldPIN = _PIN;
-// #endif
+	/* Setup interrupt pin, "INT" is open drain */
+#if ARDUINO >= 100
+	::pinMode(pin, INPUT_PULLUP); // /!\ pinMode form THE ARDUINO CORE
+#else
+	::pinMode(pin, INPUT); // /!\ pinMode form THE ARDUINO CORE
+	::digitalWrite(pin, HIGH); // /!\ digitalWrite form THE ARDUINO CORE
+#endif
 
-	/* Start request, wait for data and receive GPIO values as byte */
-	Wire.requestFrom(_address, (uint8_t) 0x01);
-	while (Wire.available() < 1)
-		;
-	_PIN = I2CREAD();
+	/* Take the current state as reference, reading also releases "INT" */
+	readGPIO();
+	_oldPIN = _PIN;
+	_intPending = 0;
+	_intEnabled = 1;
+
+	/* Attach interrupt handler */
+#if defined(__AVR__)
+	PCattachInterrupt(pin, selfCheckFunction, FALLING);
+#else
+	::attachInterrupt(digitalPinToInterrupt(pin), selfCheckFunction, FALLING);
+#endif
+}
+
+void PCF8574::disableInterrupt() {
+
+	/* Detach interrupt handler */
+#if defined(__AVR__)
+	PCdetachInterrupt(_pcintPin);
+#else
+	::detachInterrupt(digitalPinToInterrupt(_pcintPin));
+#endif
+	_intEnabled = 0;
+}
+
+bool PCF8574::update() {
+
+	/* Nothing flagged and "INT" released: the last state is still current */
+	if (!_intPending && ::digitalRead(_pcintPin) != LOW)
+		return false;
+	_intPending = 0;
+
+	/* One read gives all pins and releases "INT" */
+	uint8_t previous = _PIN;
+	readGPIO();
+	_oldPIN = previous;
+
+	/* Check all pins */
+	for (uint8_t i = 0; i < 8; ++i) {
+
+		/* Check for interrupt handler */
+		if (!_intCallback[i])
+			continue;
+
+		/* Check for interrupt event */
+		switch (_intMode[i]) {
+		case CHANGE:
+			if ((1 << i) & (_PIN ^ _oldPIN))
+				_intCallback[i]();
+			break;
+
+		case LOW:
+			if (!(_PIN & (1 << i)))
+				_intCallback[i]();
+			break;
+
+		case FALLING:
+			if ((_oldPIN & (1 << i)) && !(_PIN & (1 << i)))
+				_intCallback[i]();
+			break;
+
+		case RISING:
+			if (!(_oldPIN & (1 << i)) && (_PIN & (1 << i)))
+				_intCallback[i]();
+			break;
+		}
+	}
+	return true;
+}
+
+void PCF8574::attachInterrupt(uint8_t pin, void (*userFunc)(void),
+		uint8_t mode) {
+
+	/* Store interrupt mode and callback */
+	_intMode[pin] = mode;
+	_intCallback[pin] = userFunc;
+}
+
+void PCF8574::detachInterrupt(uint8_t pin) {
+
+	/* Void interrupt handler */
+	_intCallback[pin] = 0;
+}
+#endif
+
+void PCF8574::readGPIO() {
+
+	/* Keep the last state if the bus read fails */
+	uint8_t value;
+	if (busRead(value))
+		_PIN = value;
 }
 
 void PCF8574::updateGPIO() {
@@ -274,6 +281,27 @@ void PCF8574::updateGPIO() {
 	//uint8_t value = ((_PIN & ~_DDR) & ~(~_DDR & _PORT)) | _PORT; // Experimental
 	uint8_t value = (_PIN & ~_DDR) | _PORT;
 
+	busWrite(value);
+
+#ifdef PCF8574_INTERRUPT_SUPPORT
+	/* Outputs read back as written; inputs are refreshed by update() */
+	if (_intEnabled)
+		_PIN = value;
+#endif
+}
+
+bool PCF8574::busRead(uint8_t& value) {
+
+	/* Start request, wait for data and receive GPIO values as byte */
+	Wire.requestFrom(_address, (uint8_t) 0x01);
+	while (Wire.available() < 1)
+		;
+	value = I2CREAD();
+	return true;
+}
+
+void PCF8574::busWrite(uint8_t value) {
+
 	/* Start communication and send GPIO values as byte */
 	Wire.beginTransmission(_address);
 	I2CWRITE(value);
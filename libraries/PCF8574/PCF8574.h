@@ -56,6 +56,7 @@ public:
 	 * Create a new PCF8574 instance
 	 */
 	PCF8574();
+	virtual ~PCF8574() {}
 
 	/**
 	 * Start the I2C controller and store the PCF8574 chip address
@@ -150,12 +151,12 @@ public:
 	/**
 	 * Enable interrupts support and setup interrupts handler
 	 * 
-	 * @remarks Any pin can be used as "INT" pin, internally the library use PCINT to work.
-	 * @warning The check wrapping routine must be provided by user and define in the global scope space.
+	 * @remarks Any pin can be used as "INT" pin (attachInterrupt() on the ESP8266, PCINT on AVR).
+	 * @warning The check wrapping routine must be provided by user and define in the global scope space (ICACHE_RAM_ATTR on the ESP8266).
 	 * @param pin The pin OF YOUR ARDUINO (not the PCF8574) to use as "INT" pin for interrupts detection
-	 * @param selfCheckFunction The wrapping routine used to process interrupts events.
-	 * @remarks For best performances you should avoid this "user friendly" fonction and use the standard attachInterrupt() fonction ;)
+	 * @param selfCheckFunction The wrapping routine, it must call checkForInterrupt() of every PCF8574 on that "INT" pin.
 	 * @remarks If multiple PCF8574 are wired on the same "INT" pin this function should be called only one time
+	 * @remarks Once enabled, read() and digitalRead() are served from the last state and only touch the bus after an interrupt
 	 */
 	void enableInterrupt(uint8_t pin, void (*selfCheckFunction)(void));
 
@@ -165,11 +166,24 @@ public:
 	void disableInterrupt();
 
 	/**
-	 * Check for interrupt and process routine
+	 * Flag an interrupt for this PCF8574 instance
 	 * 
-	 * @remarks Call this routine from your wrapping routine to detect and process interrupts (if any) of this PCF8574 instance.
+	 * @remarks Call this routine from your wrapping routine. It is ISR safe: it only sets a flag, the bus is read by update().
+	 * @remarks Forced inline so it runs from the wrapping routine's IRAM on the ESP8266, not from flash.
 	 */
-	void checkForInterrupt();
+	inline __attribute__((always_inline)) void checkForInterrupt() {
+
+		/* Runs in the ISR: no I2C here, update() does the read */
+		_intPending = 1;
+	}
+
+	/**
+	 * Process a flagged interrupt
+	 * 
+	 * @remarks Call from loop(). Does one I2C read if an interrupt was flagged (or "INT" is still low), diffs it against the last state and calls the attached callbacks.
+	 * @return true if the bus was read
+	 */
+	bool update();
 
 	/**
 	 * Attach a function to an interrupt event of a pin of the PCF8574
@@ -206,8 +220,11 @@ protected:
 	/** Old value of _PIN variable */
 	volatile uint8_t _oldPIN;
 	
-	/** ISR ignore flag */
-	volatile uint8_t _isrIgnore;
+	/** Interrupt flagged by checkForInterrupt(), cleared by update() */
+	volatile uint8_t _intPending;
+
+	/** Interrupts support enabled */
+	uint8_t _intEnabled;
 
 	/** PCINT pin used for "INT" pin handling */
 	uint8_t _pcintPin;
@@ -233,6 +250,22 @@ protected:
 	 * @warning To work properly (and avoid any states conflicts) readGPIO() MUST be called before call this function !
 	 */
 	void updateGPIO();
+
+	/**
+	 * Read the GPIO states from the chip, one bus transaction
+	 *
+	 * @param value The states read
+	 * @return False if nothing was read (_PIN is left as is)
+	 * @remarks Override to route the bus traffic elsewhere (e.g. through a shared shadow register)
+	 */
+	virtual bool busRead(uint8_t& value);
+
+	/**
+	 * Write the GPIO states to the chip, one bus transaction
+	 *
+	 * @param value The states to write
+	 */
+	virtual void busWrite(uint8_t value);
 };
 
 #endif
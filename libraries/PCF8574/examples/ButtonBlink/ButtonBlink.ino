@@ -12,6 +12,11 @@
 #include <Wire.h>    // Required for I2C communication
 #include "PCF8574.h" // Required for PCF8574
 
+/* ISRs must live in IRAM on the ESP8266; the attribute is empty elsewhere */
+#ifndef ICACHE_RAM_ATTR
+#define ICACHE_RAM_ATTR
+#endif
+
 /** PCF8574 instance */
 PCF8574 expander;
 
@@ -38,12 +43,12 @@ void setup() {
   expander.digitalWrite(0, HIGH); // Turn off led 1
 }
 
-/** This function will be called each time the state of a pin of the PCF8574 change */
-void ISRgateway() {
+/** This function will be called each time the state of a pin of the PCF8574 change (it only flags it) */
+ICACHE_RAM_ATTR void ISRgateway() {
   expander.checkForInterrupt();
 }
 
-/** This function will be called each time the button on pin 3 is pressed (LOW-to-HIGH transition) */
+/** This function will be called from update() each time the button on pin 3 is pressed (HIGH-to-LOW transition) */
 void ISRdemo() {
 
   /* Blink hardware LED for debug */
@@ -59,6 +64,9 @@ void ISRdemo() {
 /** loop() */
 void loop() {
 
+  /* Read the pins once if /INT fired and run the pin callbacks */
+  expander.update();
+
   /* Blink demo */
   expander.blink(1, 5, 500); // Blink led 2
   delay(1000);
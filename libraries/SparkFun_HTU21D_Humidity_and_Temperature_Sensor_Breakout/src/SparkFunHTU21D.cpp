@@ -18,6 +18,8 @@
  Call HTU21D.Begin() in setup.
  HTU21D.ReadHumidity() will return a float containing the humidity. Ex: 54.7
  HTU21D.ReadTemperature() will return a float containing the temperature in Celsius. Ex: 24.1
+ HTU21D.startMeasurement() starts humidity then temperature without blocking; call HTU21D.poll() from
+ loop() until it returns HTU21D_READY (or HTU21D_ERROR), then read HTU21D.humidity() and HTU21D.temperature().
  HTU21D.SetResolution(byte: 0b.76543210) sets the resolution of the readings.
  HTU21D.check_crc(message, check_value) verifies the 8-bit CRC generated by the sensor
  HTU21D.read_user_register() returns the user register. Used to set resolution.
@@ -30,6 +32,13 @@
 HTU21D::HTU21D()
 {
   //Set initial values for private vars
+  _resolution = 0; //Power on default
+  _pending = 0;
+  _next = 0;
+  _result = HTU21D_IDLE;
+  _started = 0;
+  _humidity = 0;
+  _temperature = 0;
 }
 
 //Begin
@@ -38,110 +47,170 @@ HTU21D::HTU21D()
 void HTU21D::begin(void)
 {
   Wire.begin();
+
+  //The sensor keeps its resolution across our resets; learn it for the deadlines
+  Wire.beginTransmission(HTDU21D_ADDRESS);
+  Wire.write(READ_USER_REG);
+  if(Wire.endTransmission() == 0 && Wire.requestFrom(HTDU21D_ADDRESS, 1) == 1)
+    _resolution = Wire.read() & 0x81;
 }
 
 //Read the humidity
 /*******************************************************************************************/
 //Calc humidity and return it to the user
-//Returns 998 if I2C timed out 
+//Blocks until the conversion is done (16mS at full resolution)
+//Returns 998 if I2C timed out or another measurement is running
 //Returns 999 if CRC is wrong
 float HTU21D::readHumidity(void)
 {
-	//Request a humidity reading
-	Wire.beginTransmission(HTDU21D_ADDRESS);
-	Wire.write(TRIGGER_HUMD_MEASURE_NOHOLD); //Measure humidity with no bus holding
-	Wire.endTransmission();
-
-	//Hang out while measurement is taken. 50mS max, page 4 of datasheet.
-	delay(55);
-
-	//Comes back in three bytes, data(MSB) / data(LSB) / Checksum
-	Wire.requestFrom(HTDU21D_ADDRESS, 3);
-
-	//Wait for data to become available
-	int counter = 0;
-	while(Wire.available() < 3)
-	{
-		counter++;
-		delay(1);
-		if(counter > 100) return 998; //Error out
-	}
-
-	byte msb, lsb, checksum;
-	msb = Wire.read();
-	lsb = Wire.read();
-	checksum = Wire.read();
-
-	/* //Used for testing
-	byte msb, lsb, checksum;
-	msb = 0x4E;
-	lsb = 0x85;
-	checksum = 0x6B;*/
-	
-	unsigned int rawHumidity = ((unsigned int) msb << 8) | (unsigned int) lsb;
-
-	if(check_crc(rawHumidity, checksum) != 0) return(999); //Error out
-
-	//sensorStatus = rawHumidity & 0x0003; //Grab only the right two bits
-	rawHumidity &= 0xFFFC; //Zero out the status bits but keep them in place
-	
-	//Given the raw humidity data, calculate the actual relative humidity
-	float tempRH = rawHumidity / (float)65536; //2^16 = 65536
-	float rh = -6 + (125 * tempRH); //From page 14
-	
-	return(rh);
+	if(!startHumidity()) return(998);
+	while(poll() == HTU21D_BUSY) delay(1);
+	return(_humidity);
 }
 
 //Read the temperature
 /*******************************************************************************************/
 //Calc temperature and return it to the user
-//Returns 998 if I2C timed out 
+//Blocks until the conversion is done (50mS at full resolution)
+//Returns 998 if I2C timed out or another measurement is running
 //Returns 999 if CRC is wrong
 float HTU21D::readTemperature(void)
 {
-	//Request the temperature
-	Wire.beginTransmission(HTDU21D_ADDRESS);
-	Wire.write(TRIGGER_TEMP_MEASURE_NOHOLD);
-	Wire.endTransmission();
+	if(!startTemperature()) return(998);
+	while(poll() == HTU21D_BUSY) delay(1);
+	return(_temperature);
+}
 
-	//Hang out while measurement is taken. 50mS max, page 4 of datasheet.
-	delay(55);
+//Non-blocking measurements
+/*******************************************************************************************/
+//Trigger a conversion in no-hold master mode and return straight away. The
+//sensor NACKs reads until it is done, so the bus stays free meanwhile.
+bool HTU21D::startHumidity(void)
+{
+	return(start(TRIGGER_HUMD_MEASURE_NOHOLD));
+}
 
-	//Comes back in three bytes, data(MSB) / data(LSB) / Checksum
-	Wire.requestFrom(HTDU21D_ADDRESS, 3);
+bool HTU21D::startTemperature(void)
+{
+	return(start(TRIGGER_TEMP_MEASURE_NOHOLD));
+}
 
-	//Wait for data to become available
-	int counter = 0;
-	while(Wire.available() < 3)
+//Humidity, then temperature triggered by the poll() that reads the humidity
+bool HTU21D::startMeasurement(void)
+{
+	if(!start(TRIGGER_HUMD_MEASURE_NOHOLD)) return(false);
+	_next = TRIGGER_TEMP_MEASURE_NOHOLD;
+	return(true);
+}
+
+//Reads the result once the conversion deadline has passed, checks the CRC
+//and triggers the next measurement of a pair. Never waits.
+byte HTU21D::poll(void)
+{
+	if(_pending != 0)
 	{
-		counter++;
-		delay(1);
-		if(counter > 100) return 998; //Error out
+		unsigned long elapsed = millis() - _started;
+		unsigned int deadline = conversion_ms(_pending);
+		if(elapsed <= deadline) return(HTU21D_BUSY);
+
+		float value;
+
+		//Comes back in three bytes, data(MSB) / data(LSB) / Checksum
+		if(Wire.requestFrom(HTDU21D_ADDRESS, 3) < 3)
+		{
+			//NACK: still converting (or gone)
+			if(elapsed <= deadline + HTU21D_TIMEOUT_MS) return(HTU21D_BUSY);
+			value = 998;
+		}
+		else
+		{
+			byte msb, lsb, checksum;
+			msb = Wire.read();
+			lsb = Wire.read();
+			checksum = Wire.read();
+
+			unsigned int raw = ((unsigned int) msb << 8) | (unsigned int) lsb;
+
+			if(check_crc(raw, checksum) != 0)
+				value = 999;
+			else
+			{
+				//sensorStatus = raw & 0x0003; //Grab only the right two bits
+				raw &= 0xFFFC; //Zero out the status bits but keep them in place
+				float scaled = raw / (float)65536; //2^16 = 65536
+
+				//From page 14
+				if(_pending == TRIGGER_HUMD_MEASURE_NOHOLD)
+					value = -6 + (125 * scaled);
+				else
+					value = (float)(-46.85 + (175.72 * scaled));
+			}
+		}
+
+		if(value >= 998) _result = HTU21D_ERROR;
+		if(_pending == TRIGGER_HUMD_MEASURE_NOHOLD) _humidity = value;
+		else _temperature = value;
+		_pending = 0;
+
+		if(_next != 0)
+		{
+			byte next = _next;
+			_next = 0;
+			if(trigger(next)) return(HTU21D_BUSY);
+
+			_result = HTU21D_ERROR;
+			if(next == TRIGGER_HUMD_MEASURE_NOHOLD) _humidity = 998;
+			else _temperature = 998;
+		}
 	}
 
-	unsigned char msb, lsb, checksum;
-	msb = Wire.read();
-	lsb = Wire.read();
-	checksum = Wire.read();
+	//Report a finished measurement once
+	byte result = _result;
+	_result = HTU21D_IDLE;
+	return(result);
+}
 
-	/* //Used for testing
-	byte msb, lsb, checksum;
-	msb = 0x68;
-	lsb = 0x3A;
-	checksum = 0x7C; */
+float HTU21D::humidity(void)
+{
+	return(_humidity);
+}
 
-	unsigned int rawTemperature = ((unsigned int) msb << 8) | (unsigned int) lsb;
+float HTU21D::temperature(void)
+{
+	return(_temperature);
+}
+
+bool HTU21D::start(byte command)
+{
+	if(_pending != 0) return(false);
+	_next = 0;
+	_result = HTU21D_IDLE;
+	if(!trigger(command)) return(false);
+	_result = HTU21D_READY;
+	return(true);
+}
 
-	if(check_crc(rawTemperature, checksum) != 0) return(999); //Error out
+bool HTU21D::trigger(byte command)
+{
+	Wire.beginTransmission(HTDU21D_ADDRESS);
+	Wire.write(command);
+	if(Wire.endTransmission() != 0) return(false);
 
-	//sensorStatus = rawTemperature & 0x0003; //Grab only the right two bits
-	rawTemperature &= 0xFFFC; //Zero out the status bits but keep them in place
+	_pending = command;
+	_started = millis();
+	return(true);
+}
 
-	//Given the raw temperature data, calculate the actual temperature
-	float tempTemperature = rawTemperature / (float)65536; //2^16 = 65536
-	float realTemperature = (float)(-46.85 + (175.72 * tempTemperature)); //From page 14
+//Maximum conversion time for the current resolution, page 3 of datasheet.
+//Indexed by the resolution bits (7, 0): 12/14, 8/12, 10/13 and 11/11 bit RH/Temp.
+unsigned int HTU21D::conversion_ms(byte command)
+{
+	static const byte humidityMs[4] = { 16, 3, 5, 8 };
+	static const byte temperatureMs[4] = { 50, 13, 25, 7 };
 
-	return(realTemperature);  
+	byte index = ((_resolution >> 6) & 2) | (_resolution & 1);
+	if(command == TRIGGER_HUMD_MEASURE_NOHOLD) return(humidityMs[index]);
+	return(temperatureMs[index]);
 }
 
 //Set sensor resolution
@@ -157,9 +226,10 @@ float HTU21D::readTemperature(void)
 void HTU21D::setResolution(byte resolution)
 {
   byte userRegister = read_user_register(); //Go get the current register state
-  userRegister &= B01111110; //Turn off the resolution bits
-  resolution &= B10000001; //Turn off all other bits but resolution bits
+  userRegister &= 0x7E; //Turn off the resolution bits (B01111110)
+  resolution &= 0x81; //Turn off all other bits but resolution bits (B10000001)
   userRegister |= resolution; //Mask in the requested resolution bits
+  _resolution = resolution;
   
   //Request a write to user register
   Wire.beginTransmission(HTDU21D_ADDRESS);
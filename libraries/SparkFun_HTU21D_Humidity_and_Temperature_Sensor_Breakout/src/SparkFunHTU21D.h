@@ -28,6 +28,16 @@
 #define READ_USER_REG  0xE7
 #define SOFT_RESET  0xFE
 
+//A no-hold measurement the sensor has not finished by its datasheet deadline
+//is retried on each poll() for this long before it counts as an I2C timeout
+#define HTU21D_TIMEOUT_MS 100
+
+//poll() results
+#define HTU21D_IDLE  0 //Nothing started, or the last result was already returned
+#define HTU21D_BUSY  1 //Still converting
+#define HTU21D_READY 2 //Everything started has been read
+#define HTU21D_ERROR 3 //Done, but a value is 998 (I2C timeout) or 999 (bad CRC)
+
 class HTU21D {
 
 public:
@@ -39,6 +49,17 @@ public:
   float readTemperature(void);
   void setResolution(byte resBits);
 
+  //Non-blocking: start a measurement, then call poll() from loop() until it
+  //is no longer HTU21D_BUSY. startMeasurement() runs humidity and temperature
+  //back to back. The start functions return false if the sensor did not ack
+  //or a measurement is still running.
+  bool startHumidity(void);
+  bool startTemperature(void);
+  bool startMeasurement(void);
+  byte poll(void);
+  float humidity(void);
+  float temperature(void);
+
   //Public Variables
 
 private:
@@ -46,7 +67,17 @@ private:
 
   byte read_user_register(void);
   byte check_crc(uint16_t message_from_sensor, uint8_t check_value_from_sensor);
+  bool start(byte command);
+  bool trigger(byte command);
+  unsigned int conversion_ms(byte command);
 
   //Private Variables
+  byte _resolution; //User register resolution bits, for the conversion deadlines
+  byte _pending;    //Command of the conversion in progress, 0 if none
+  byte _next;       //Command to trigger once it completes, 0 if none
+  byte _result;     //What poll() returns once nothing is pending
+  unsigned long _started;
+  float _humidity;
+  float _temperature;
 
 };
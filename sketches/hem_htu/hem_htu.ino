@@ -1,9 +1,14 @@
 #include <ESP8266WiFi.h>
 #include <ESP8266mDNS.h>
 #include <ArduinoOTA.h>
+#include <FastConnect.h>
+#include <LittleFS.h>
+#include <TelemetryStore.h>
+#include <LittleFSSpill.h>
 #include <PubSubClient.h>
 #include <Wire.h>
 #include <SparkFunHTU21D.h>
+#include <Psychrometrics.h>
 
 WiFiClient espClient;
 PubSubClient mqtt(espClient);
@@ -13,8 +18,19 @@ const char* server = "192.168.1.2";
 const char* ssid = "Mitchell";
 const char* password = "easypassword";
 
+FastConnect wifi(ssid, password, "htu");
+
 unsigned long lastTemp;
-float rh, temp, comprh, dew;
+float rh, temp, comprh;
+
+// Live readings and the replayed backlog go out through here.
+bool mqttPublish(const char* topic, const char* payload) {
+  return mqtt.connected() && mqtt.publish(topic, payload);
+}
+
+// Readings taken while the broker is unreachable, replayed on reconnect.
+LittleFSSpill spill;
+TelemetryStore store(&spill, mqttPublish);
 
 void callback(char* topic, byte* payload, unsigned int length) {
   String payloads;
@@ -24,52 +40,23 @@ void callback(char* topic, byte* payload, unsigned int length) {
 }
 
 void wifiConnect() {
-  WiFi.mode(WIFI_STA);
-  WiFi.hostname("htu");
-  WiFi.begin(ssid, password);
-  while (WiFi.status() != WL_CONNECTED) {
-    delay(200);
-    digitalWrite(2, !digitalRead(2));
-  }
-  digitalWrite(2, 1);
+  // Cached BSSID/channel/IP join, full scan only if that fails.
+  wifi.connect();
 }
 
 void mqttConnect() {
   mqtt.setServer(server, 1883);
   mqtt.setCallback(callback);
   if (mqtt.connect(WiFi.hostname().c_str())) {
+    wifi.report(mqtt);
   }
 }
 
-double dewPointFast(double celsius, double humidity) {
-  double a = 17.271;
-  double b = 237.7;
-  double temp = (a * celsius) / (b + celsius) + log(humidity * 0.01);
-  double Td = (b * temp) / (a - temp);
-  return Td;
-}
-
-// ==========================================
-// HELPER: Calculate Indoor "Feels Like" Temp
-// ==========================================
-// Based on Australian Apparent Temperature (Steadman) for Indoor/No Wind
-// Returns Celsius
-float calculateFeelsLike(float tempC, float humidityRH) {
-  // 1. Calculate Vapor Pressure (hPa)
-  // e = (rh/100) * 6.105 * exp((17.27 * T) / (237.7 + T))
-  float vaporPressure = (humidityRH / 100.0) * 6.105 * exp((17.27 * tempC) / (237.7 + tempC));
-
-  // 2. Calculate Apparent Temp (C)
-  // AT = Ta + 0.33 * e - 4.0 (The -4.0 is a baseline adjustment for lack of radiation/wind)
-  float apparentTempC = tempC + (0.33 * vaporPressure) - 4.0;
-
-  return apparentTempC;
-}
-
 void setup() {
   Serial.begin(9600);
   pinMode(2, OUTPUT);
   digitalWrite(2, 0);
+  wifi.setStatusLed(2);
 
   ArduinoOTA.onStart([]() {
     Serial.println("Start");
@@ -97,46 +84,57 @@ void setup() {
 
   Wire.begin();
   htu.begin();
-}
 
-void loop() {
-  if (WiFi.status() != WL_CONNECTED) {
-    wifiConnect();
+  if (LittleFS.begin()) {
+    spill.begin();
   }
+}
 
-  if (!mqtt.connected()) {
+void loop() {
+  // Never blocks: sampling and publishOrStore() go on while the AP is down.
+  if (wifi.service() && !mqtt.connected()) {
     mqttConnect();
   }
 
   if (millis() - lastTemp > 15000) {
     lastTemp = millis();
 
-    // Blocks for 110ms.
-    rh = htu.readHumidity();
-    temp = htu.readTemperature();
+    // Humidity then temperature, polled below; loop() keeps running.
+    htu.startMeasurement();
+  }
+
+  if (htu.poll() == HTU21D_READY) {
+    rh = htu.humidity();
+    temp = htu.temperature();
 
     // Make sure the returned humidity value is valid.
     if (32 > temp && temp > 7) {
-      // Compensate for temperature.
+      // Compensate for temperature. Published as is, even past 0..100.
       comprh = rh + (25 - temp) * -0.15;
 
-      dew = dewPointFast(temp, comprh);
-
-      // Calculate Feels Like Temp (returns C)
-      float diC = calculateFeelsLike(temp, comprh);
+      // Dew point and indoor "feels like" (Steadman) in centi-C, no libm.
+      // Psychrometrics takes 0..100 %RH, so only its input is clamped.
+      int16_t centiC = temp * 100 + 0.5;
+      uint16_t centiRh = constrain(comprh, 0, 100) * 100 + 0.5;
+      int16_t dew = Psychrometrics::dewPoint(centiC, centiRh);
+      int16_t feels = Psychrometrics::apparentTemperature(centiC, centiRh);
 
       // Convert to F
-      float dewF = dew * 9 / 5.0 + 32;
+      float dewF = dew * 0.018f + 32;
       float tempF = temp * 9 / 5.0 + 32;
-      float di = diC * 9 / 5.0 + 32;
+      float di = feels * 0.018f + 32;
 
-      mqtt.publish("temp/tempF", String(tempF).c_str());
-      mqtt.publish("temp/dewF", String(dewF).c_str());
-      mqtt.publish("temp/rh", String(comprh).c_str());
-      mqtt.publish("temp/di", String(di).c_str());
+      store.publishOrStore("temp/tempF", tempF, 2, millis() / 1000);
+      store.publishOrStore("temp/dewF", dewF, 2, millis() / 1000);
+      store.publishOrStore("temp/rh", comprh, 2, millis() / 1000);
+      store.publishOrStore("temp/di", di, 2, millis() / 1000);
     }
   }
 
+  if (mqtt.connected() && !store.empty()) {
+    store.publishReplay(millis() / 1000);
+  }
+
   mqtt.loop();
   ArduinoOTA.handle();
 }
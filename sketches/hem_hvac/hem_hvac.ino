@@ -1,6 +1,8 @@
 #include <ESP8266WiFi.h>
 #include <ESP8266mDNS.h>
 #include <ArduinoOTA.h>
+#include <FastConnect.h>
+#include <PCF8574Port.h>
 
 #include <PubSubClient.h>
 
@@ -17,6 +19,8 @@ const char* server = "192.168.1.2";
 const char* ssid     = "Mitchell";
 const char* password = "easypassword";
 
+FastConnect wifi(ssid, password, "hvac");
+
 const int addr = 0x39;
 
 const uint8_t cool = 5;
@@ -26,6 +30,13 @@ const uint8_t coolOver = 2;
 const uint8_t fanOver = 3;
 const uint8_t heatOver = 4;
 
+// Relays are active low. Each transition is one masked write to the
+// expander; reads come from the port's shadow.
+#define RELAY(p) (1 << (p))
+const uint8_t OVERRIDES = RELAY(coolOver) | RELAY(fanOver) | RELAY(heatOver);
+PCF8574Port relays(addr);
+uint32_t transitionTx = 0;
+
 const uint8_t READY = 1, COOLON = 2, HEATON = 3, COOLING = 4, HEATING = 5, FANWAIT = 6, WAIT = 7, OFF = 8;
 const uint8_t COOL = 1, HEAT = 2;
 uint8_t state = READY, hvacMode = 2;
@@ -164,14 +175,8 @@ void callback(char* topic, byte* payload, unsigned int length) {
 }
 
 void wifiConnect() {
-  WiFi.mode(WIFI_STA);
-  WiFi.hostname("hvac");
-  WiFi.begin(ssid, password);
-  while (WiFi.status() != WL_CONNECTED) {
-    delay(200);
-    digitalWrite(2, !digitalRead(2));
-  }
-  digitalWrite(2, 1);
+  // Cached BSSID/channel/IP join, full scan only if that fails.
+  wifi.connect();
   configTime(0, 0, "192.168.1.1", "pool.ntp.org");
   setenv("TZ", tzConfig, 1);
   tzset();
@@ -269,53 +274,26 @@ void mqttConnect() {
   if (mqtt.connect(WiFi.hostname().c_str())) {
     mqtt.subscribe("hvac/+");
     mqtt.subscribe("temp/tempF");
+    wifi.report(mqtt);
   }
 }
 
-void gpioWrite (uint8_t pin, uint8_t value) {
-  uint8_t data;
-  Wire.requestFrom(addr, 1);
-  if (Wire.available()) {
-    data = Wire.read();
-  } else {
-    return;
-  }
-  
-  if (value == LOW) {
-    data &= ~(1 << pin);
-  } else {
-    data |= (1 << pin);
-  }
-  
-  Wire.beginTransmission(addr);
-  Wire.write(data);
-  byte error = Wire.endTransmission();
-  
-  if (error != 0) {
+// Switch the relays in mask on (LOW) or off (HIGH) in one transaction.
+void relaysSet(uint8_t mask, uint8_t value) {
+  if (!relays.apply(mask, value == LOW ? 0 : mask)) {
     char errMsg[50];
-    snprintf(errMsg, 50, "I2C Write Error: %d", error);
+    snprintf(errMsg, 50, "I2C Write Error on 0x%02x", addr);
     mqtt.publish("hvac/error", errMsg);
   }
 }
 
-uint8_t gpioRead (uint8_t pin) {
-  uint8_t data = 0;
-  Wire.requestFrom(addr, 1);
-  if (Wire.available()) {
-    data = Wire.read();
-  }
-  return ((data >> pin) & 1);
-}
-
 void setup() {
   pinMode(2, OUTPUT);
   digitalWrite(2, 0);
+  wifi.setStatusLed(2);
 
   Wire.begin();
-
-  Wire.beginTransmission(addr);
-  Wire.write(255);
-  Wire.endTransmission();
+  relays.begin(0xFF);
 
 
   ArduinoOTA.onStart([]() {
@@ -360,8 +338,7 @@ void loop() {
     failsafeActive = true;
     state = WAIT;
     stateDelay = millis() + 300000;
-    gpioWrite(heat, HIGH); 
-    gpioWrite(cool, HIGH);
+    relaysSet(RELAY(heat) | RELAY(cool), HIGH);
     mqtt.publish("hvac/error", "FAILSAFE: Sensor data stale (>5m). Shutting down.");
   }
 
@@ -381,6 +358,7 @@ void loop() {
     lastLogicTick = millis();
     
     uint8_t oldState = state;
+    uint32_t txBefore = relays.transactions();
     
     switch (state) {
       case READY:
@@ -398,39 +376,32 @@ void loop() {
         }
         break;
       case COOLON:
-        gpioWrite(cool, LOW);
-        gpioWrite(fan, LOW);
+        relaysSet(RELAY(cool) | RELAY(fan) | OVERRIDES, LOW);
         stateDelay = millis() + 450000;
         state = COOLING;
-        gpioWrite(coolOver, LOW);
-        gpioWrite(fanOver, LOW);
-        gpioWrite(heatOver, LOW);
         break;
       case HEATON:
-        gpioWrite(heat, LOW);
+        relaysSet(RELAY(heat) | OVERRIDES, LOW);
         stateDelay = millis() + 300000;
         state = HEATING;
-        gpioWrite(coolOver, LOW);
-        gpioWrite(fanOver, LOW);
-        gpioWrite(heatOver, LOW);
         break;
       case COOLING:
         if ((tempF < coolSet - 0.5 && millis() > stateDelay) || hvacMode != COOL) {
           stateDelay = millis() + 180000;
           state = FANWAIT;
-          gpioWrite(cool, HIGH);
+          relaysSet(RELAY(cool), HIGH);
         }
         break;
       case HEATING:
         if ((tempF > heatSet + heatOffOffset && millis() > stateDelay) || hvacMode != HEAT || failsafeActive) {
           stateDelay = millis() + 300000;
           state = WAIT;
-          gpioWrite(heat, HIGH);
+          relaysSet(RELAY(heat), HIGH);
         } else if (millis() - heatStartTime > MAX_HEAT_TIME) {
           // Mandatory recovery period (15 mins)
           stateDelay = millis() + 900000; 
           state = WAIT;
-          gpioWrite(heat, HIGH);
+          relaysSet(RELAY(heat), HIGH);
           mqtt.publish("hvac/error", "Safety Cutoff: 2h run limit reached. 15m rest initiated.");
         }
         break;
@@ -438,21 +409,22 @@ void loop() {
         if (millis() > stateDelay) {
           stateDelay = millis() + 300000;
           state = WAIT;
-          gpioWrite(fan, HIGH);
+          relaysSet(RELAY(fan), HIGH);
         }
         break;
       case WAIT:
         if (millis() > stateDelay) {
           state = READY;
-          gpioWrite(coolOver, HIGH);
-          gpioWrite(fanOver, HIGH);
-          gpioWrite(heatOver, HIGH);
+          relaysSet(OVERRIDES, HIGH);
         }
         break;
     }
 
     // Force an immediate status update if state changed
-    if (state != oldState) machineDelay = 0;
+    if (state != oldState) {
+      machineDelay = 0;
+      transitionTx = relays.transactions() - txBefore;
+    }
   }
 
   // Periodic Status Reporting (every 15s)
@@ -471,19 +443,31 @@ void loop() {
     }
     mqtt.publish("hvac/state", stateStr.c_str());
     
-    // Publish Relay State (Bitmask)
+    // Publish Relay State (Bitmask), from the shadow.
     uint8_t relayState = 0;
-    relayState |= (gpioRead(heat) << 5);
-    relayState |= (gpioRead(fan) << 4);
-    relayState |= (gpioRead(cool) << 3);
-    relayState |= (gpioRead(heatOver) << 2);
-    relayState |= (gpioRead(fanOver) << 1);
-    relayState |= (gpioRead(coolOver) << 0);
+    relayState |= (relays.digitalRead(heat) << 5);
+    relayState |= (relays.digitalRead(fan) << 4);
+    relayState |= (relays.digitalRead(cool) << 3);
+    relayState |= (relays.digitalRead(heatOver) << 2);
+    relayState |= (relays.digitalRead(fanOver) << 1);
+    relayState |= (relays.digitalRead(coolOver) << 0);
     mqtt.publish("hvac/relays", String(relayState).c_str());
+    mqtt.publish("hvac/i2c/tx_per_transition", String(transitionTx).c_str());
     
 
   }
 
+  // Read the expander back now and then; rewrites it if it lost state.
+  // A failed bus transaction (readback or rewrite) shows in errors().
+  uint32_t relayErrors = relays.errors();
+  if (!relays.service(millis())) {
+    if (relays.errors() != relayErrors) {
+      mqtt.publish("hvac/error", "Relay expander I2C error");
+    } else {
+      mqtt.publish("hvac/error", "Relay readback mismatch, rewritten");
+    }
+  }
+
   // Heartbeat (every 30s)
   if (millis() > heartbeatDelay) {
     heartbeatDelay = millis() + 30000;
@@ -2,6 +2,19 @@
 #include <ESP8266mDNS.h>
 #include <WiFiUdp.h>
 #include <ArduinoOTA.h>
+#include <FastConnect.h>
+#include <PulseRing.h>
+#include <PowerEstimator.h>
+#include <EnergyWindow.h>
+#include <ApplianceDetector.h>
+#include <PeriodicityBank.h>
+#include <ReadingBatch.h>
+#include <EnergyBudget.h>
+#include <PowerSave.h>
+#include <LittleFS.h>
+#include <TelemetryStore.h>
+#include <LittleFSSpill.h>
+#include <SensorRegistry.h>
 
 // One Wire init straight from examples.
 #include <OneWire.h>
@@ -31,11 +44,12 @@ const char* server = "192.168.1.2";
 const char* ssid     = "Mitchell";
 const char* password = "easypassword";
 
+FastConnect wifi(ssid, password, "pwrmtr");
+
 //Time variables
-unsigned long wNewTime, wOldTime, lastTemp, stateDelay;
+unsigned long wOldTime, lastTemp, stateDelay;
 
 boolean firstRun = true;
-boolean wPulse = false;
 boolean conversionInProgress = false;
 
 float battVoltage = 0;
@@ -44,28 +58,317 @@ unsigned long lastBattRead = 0;
 
 #define W_SENSOR 12
 
+// Pulse timestamps (micros) queued by the ISR. 32 pulses is ~25 s of
+// backlog at 4.5 kW, longer than any MQTT reconnect or 1-Wire rescan.
+PulseRing<32> pulses;
+uint32_t reportedOverflows = 0;
+
+// Between pulses the last reading is only an upper bound; at 150 W the next
+// pulse is 24 s away. Publish the decaying bound so a load switching off
+// shows up within a couple of seconds.
+#define ESTIMATE_INTERVAL_MS 2000
+PowerEstimator estimator;
+unsigned long lastEstimate = 0;
+
+// Per-pulse publishes cost a Wi-Fi TX every 0.8 s at 4.5 kW, and everything
+// downstream resamples to minutes anyway. Publish per window instead, on
+// power/10s, power/1m and power/15m. Define RAW_POWER_STREAM to also get the
+// per-pulse watts on power/W, e.g. while debugging the pulse input.
+//#define RAW_POWER_STREAM
+void publishWindow(const EnergySummary& s);
+EnergyWindow window10s(10000, publishWindow);
+EnergyWindow window1m(60000, publishWindow);
+EnergyWindow window15m(900000, publishWindow);
+
+// Step-change appliance detection. Seeded with the signatures in MEMORIES.md;
+// anything else that keeps showing up is learned (up to 8 in total).
+void publishApplianceEvent(const ApplianceEvent& e);
+ApplianceDetector appliances(publishApplianceEvent);
+
+// Cycle periods from the 1-minute means. The laundry room space heater is
+// the only thing keeping those pipes from freezing (MEMORIES.md); if its
+// ~62 min cycle disappears while it is freezing outside, raise an alarm.
+#define OUTDOOR_TEMP_TOPIC "temp/284a046d4c2001a3"
+#define FREEZE_F 32.0
+#define OUTDOOR_MAX_AGE_MS 1800000
+#define HEATER_ALARM_AMPLITUDE_W 100
+PeriodicityBank cycles;
+int8_t heaterBand;
+float outdoorF = NAN;
+unsigned long outdoorAt = 0;
+bool heaterAlarm = false;
+
+// Power-save mode (retained "1" on pwrmtr/powersave): the modem sleeps while
+// the pulse ISR and aggregation keep running. Readings queue in `batch` with
+// their timestamps and go out in one burst every
+// POWER_SAVE_FLUSH_INTERVAL_MS, or sooner on a big power step, a heater
+// alarm or low battery. The node only listens while awake, so turning the
+// mode off (e.g. for OTA) takes effect at the next wake. Timing and power
+// figures are in PowerSave.h, shared with the host simulation.
+#define POWER_SAVE_TOPIC "pwrmtr/powersave"
+#define LOW_BATT_PERCENT 20
+#define WAKE_TIMEOUT_MS 30000     // Give up on a wake that can't reach the broker
+enum BatchChannel { CH_W_1M, CH_EVENT_DW, CH_MWH_15M };
+const char* BATCH_LEGEND = "[\"W_1m\",\"event_dW\",\"mWh_15m\"]";
+ReadingBatch<64> batch;
+EnergyBudget budget(POWER_SAVE_IDLE_MW, POWER_SAVE_RADIO_MW);
+bool powerSave = false;
+bool radioAsleep = false;
+bool wakeRequested = false;
+bool wakePending = false;
+bool lowBattReported = false;
+unsigned long lastWake = 0;
+
+bool online() {
+  return !radioAsleep && mqtt.connected();
+}
+
+// Live readings and the replayed backlog go out through here.
+bool mqttPublish(const char* topic, const char* payload) {
+  return online() && mqtt.publish(topic, payload);
+}
+
+// Outside power-save, readings taken while the broker is unreachable
+// (temperatures, minute means) are kept here and replayed on reconnect.
+LittleFSSpill spill;
+TelemetryStore store(&spill, mqttPublish);
+
+// DS18B20s by ROM with their topics preformatted. The bus is only searched
+// at boot, every SENSOR_RESCAN_MS (hot swap) and after a failed read.
+#define SENSOR_DEADBAND_F 0.2
+#define SENSOR_MAX_AGE_MS 300000
+#define SENSOR_RESCAN_MS 300000
+SensorRegistry tempSensors("temp/", SENSOR_DEADBAND_F, SENSOR_MAX_AGE_MS, SENSOR_RESCAN_MS);
+
 ICACHE_RAM_ATTR void wPulsed() {
-  wNewTime = micros();
-  wPulse = true;
+  pulses.push(micros());
+}
+
+void discoverSensors() {
+  // Cost of the last read cycle, to keep an eye on it.
+  if (tempSensors.rescan(sensors, millis()) && online() && tempSensors.cycleUs()) {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%lu", (unsigned long)tempSensors.cycleUs());
+    mqtt.publish("pwrmtr/temp/cycle_us", buf, true);
+  }
+}
+
+void publishTemp(const char* topic, float value) {
+  store.publishOrStore(topic, value, 2, millis() / 1000);
+}
+
+void publishWindow(const EnergySummary& s) {
+  if (s.lengthMs == 60000) {
+    cycles.sample(s.meanW > 32767 ? 32767 : (int16_t)s.meanW);
+  } else if (s.lengthMs == 900000) {
+    publishCycles();
+  }
+
+  if (powerSave) {
+    // Minute means and exact 15 min energy are enough to rebuild the curve.
+    if (s.lengthMs == 60000) {
+      batch.push(s.startMs + s.lengthMs, CH_W_1M, s.meanW);
+    } else if (s.lengthMs == 900000) {
+      batch.push(s.startMs + s.lengthMs, CH_MWH_15M, s.mWh);
+    }
+    return;
+  }
+
+  if (!online()) {
+    // The minute mean is what the history needs; the rest can be lost.
+    if (s.lengthMs == 60000) {
+      store.append(store.series("power/1m/w", 0), (s.startMs + s.lengthMs) / 1000, s.meanW);
+    }
+    return;
+  }
+
+  const char* topic = s.lengthMs == 10000 ? "power/10s" : s.lengthMs == 60000 ? "power/1m" : "power/15m";
+  char buf[96];
+  snprintf(buf, sizeof(buf), "{\"kwh\":%lu.%06lu,\"w\":%lu,\"min\":%lu,\"max\":%lu,\"n\":%u}",
+           (unsigned long)(s.mWh / 1000000), (unsigned long)(s.mWh % 1000000),
+           (unsigned long)s.meanW, (unsigned long)s.minW, (unsigned long)s.maxW, s.pulses);
+  mqtt.publish(topic, buf);
+}
+
+void publishCycles() {
+  if (!cycles.ready()) return;
+
+  char topic[32];
+  char buf[48];
+  for (uint8_t b = 0; b < cycles.bandCount(); b++) {
+    snprintf(topic, sizeof(topic), "power/cycle/%s", cycles.bandName(b));
+    snprintf(buf, sizeof(buf), "{\"period_min\":%.1f,\"amp_w\":%d}",
+             cycles.dominantPeriod(b), (int)cycles.amplitude(b));
+    mqtt.publish(topic, buf);
+  }
+
+  bool freezing = !isnan(outdoorF) && millis() - outdoorAt < OUTDOOR_MAX_AGE_MS && outdoorF < FREEZE_F;
+  bool alarm = freezing && cycles.amplitude(heaterBand) < HEATER_ALARM_AMPLITUDE_W;
+  if (alarm != heaterAlarm) {
+    if (online()) {
+      heaterAlarm = alarm;
+      mqtt.publish("power/alarm/heater", alarm ? "1" : "0", true);
+    } else {
+      wakeRequested = true;
+    }
+  }
+}
+
+void publishApplianceEvent(const ApplianceEvent& e) {
+  if (powerSave) {
+    batch.push(e.atMs, CH_EVENT_DW, e.deltaW);
+    if ((uint32_t)abs(e.deltaW) >= POWER_SAVE_WAKE_STEP_W) wakeRequested = true;
+    return;
+  }
+
+  char name[12];
+  if (e.name) {
+    snprintf(name, sizeof(name), "%s", e.name);
+  } else if (e.signature >= 0) {
+    snprintf(name, sizeof(name), "sig%d", e.signature);
+  } else {
+    snprintf(name, sizeof(name), "unknown");
+  }
+
+  char buf[128];
+  int n = snprintf(buf, sizeof(buf), "{\"app\":\"%s\",\"edge\":\"%s\",\"dw\":%ld,\"w\":%lu",
+                   name, e.edge == APPLIANCE_ON ? "on" : "off", (long)e.deltaW, (unsigned long)e.levelW);
+  if (e.runMs) {
+    n += snprintf(buf + n, sizeof(buf) - n, ",\"run_s\":%lu,\"wh\":%lu",
+                  (unsigned long)(e.runMs / 1000), (unsigned long)e.runWh);
+  }
+  snprintf(buf + n, sizeof(buf) - n, "}");
+  mqtt.publish("power/event", buf);
+}
+
+void handlePulse(unsigned long wNewTime) {
+  unsigned long dt = wNewTime - wOldTime;
+
+  // Debounce: Reject pulses faster than 100ms (100,000 µs).
+  // 100A service @ 240V = 24kW max. 100ms = 36kW equivalent.
+  // Any pulse below this threshold is physically impossible and
+  // is an optical double-trigger from the IR test port.
+  if (!firstRun && dt < 100000) {
+    // Log rejected pulse for diagnostics, do NOT update wOldTime
+    mqtt.publish("power/rejected", String(3600000000.0 / (float)dt, 2).c_str());
+  } else if (!firstRun) {
+    // 1Wh per pulse. 3600s * 1,000,000us / dt
+    float currentW = 3600000000.0 / (float)dt;
+    uint32_t watts = (uint32_t)(currentW + 0.5);
+
+#ifdef RAW_POWER_STREAM
+    if (!powerSave) {
+      mqtt.publish("power/W", String(currentW, 2).c_str());
+    }
+#endif
+
+    // Pulse time on the millis() clock (it may have sat in the ring a while).
+    unsigned long nowMs = millis() - (micros() - wNewTime) / 1000;
+    window10s.pulse(nowMs, dt, watts);
+    window1m.pulse(nowMs, dt, watts);
+    window15m.pulse(nowMs, dt, watts);
+    appliances.pulse(nowMs, watts);
+
+    // Snap the estimate back to the real measurement if it had been decaying.
+    bool wasDecaying = estimator.decaying(wNewTime);
+    estimator.pulse(wNewTime, watts);
+    if (wasDecaying) {
+      mqtt.publish("power/estimate", String(estimator.measured()).c_str());
+    }
+
+    wOldTime = wNewTime;
+    digitalWrite(0, !digitalRead(0));
+  } else {
+    // First pulse after startup — establish baseline, no publish
+    firstRun = false;
+    wOldTime = wNewTime;
+    digitalWrite(0, !digitalRead(0));
+  }
 }
 
 void wifiConnect() {
-  WiFi.mode(WIFI_STA);
-  WiFi.hostname("pwrmtr");
-  WiFi.begin(ssid, password);
-  while (WiFi.status() != WL_CONNECTED) {
-    delay(200);
-    digitalWrite(2, !digitalRead(2));
+  // Cached BSSID/channel/IP join, full scan only if that fails.
+  wifi.connect();
+}
+
+void callback(char* topic, byte* payload, unsigned int length) {
+  if (strcmp(topic, POWER_SAVE_TOPIC) == 0) {
+    powerSave = length > 0 && payload[0] == '1';
+  } else if (strcmp(topic, OUTDOOR_TEMP_TOPIC) == 0) {
+    char buf[16];
+    if (length >= sizeof(buf)) length = sizeof(buf) - 1;
+    memcpy(buf, payload, length);
+    buf[length] = 0;
+    outdoorF = atof(buf);
+    outdoorAt = millis();
   }
-  digitalWrite(2, 1);
 }
 
 void mqttConnect() {
   mqtt.setServer(server, 1883);
+  mqtt.setCallback(callback);
   if (mqtt.connect(WiFi.hostname().c_str())) {
+    mqtt.subscribe(OUTDOOR_TEMP_TOPIC);
+    mqtt.subscribe(POWER_SAVE_TOPIC);
+    mqtt.publish("pwrmtr/batch/legend", BATCH_LEGEND, true);
+    wifi.report(mqtt);
   }
 }
 
+// Publish everything queued while the modem slept, in as few messages as
+// fit the MQTT buffer.
+void flushBatch() {
+  char buf[MQTT_MAX_PACKET_SIZE - 64];
+  while (batch.size()) {
+    uint16_t n = batch.format(millis(), buf, sizeof(buf));
+    if (!n || !mqtt.publish("pwrmtr/batch", buf)) break;
+    batch.drop(n);
+  }
+  if (batch.dropped()) {
+    mqtt.publish("pwrmtr/batch/dropped", String(batch.dropped()).c_str(), true);
+  }
+}
+
+void publishBudget() {
+  char buf[16];
+  snprintf(buf, sizeof(buf), "%lu", (unsigned long)(budget.onMsPerHour(millis()) / 1000));
+  mqtt.publish("pwrmtr/radio/on_s_per_hour", buf, true);
+  snprintf(buf, sizeof(buf), "%lu", (unsigned long)budget.projectedHours(millis(), POWER_SAVE_PACK_WH, battPercent));
+  mqtt.publish("pwrmtr/battery/hours", buf, true);
+}
+
+void radioSleep() {
+  mqtt.disconnect();
+  wifi.disconnect();
+  WiFi.forceSleepBegin();
+  radioAsleep = true;
+  budget.radioOff(millis());
+}
+
+// The join itself runs from loop(); finishWake() flushes once the broker
+// is reachable.
+void radioWake() {
+  budget.radioOn(millis());
+  WiFi.forceSleepWake();
+  radioAsleep = false;
+  wakePending = true;
+  lastWake = millis();
+  wakeRequested = false;
+}
+
+void finishWake() {
+  wakePending = false;
+  // Let retained messages (power-save toggle, outdoor temp) arrive.
+  mqtt.loop();
+
+  lastWake = millis();
+  flushBatch();
+  publishCycles();
+  // Take a temperature and battery reading while the radio is up.
+  lastTemp = millis() - 15001;
+  lastBattRead = 0;
+}
+
 void setup() {
   Serial.begin(9600);
 
@@ -73,11 +376,21 @@ void setup() {
   digitalWrite(0, 1);
   pinMode(2, OUTPUT);
   digitalWrite(2, 0);
+  wifi.setStatusLed(2);
 
   //Enable external interrupt of digital I/O pin 12
   pinMode(W_SENSOR, INPUT);
   attachInterrupt(W_SENSOR, wPulsed, FALLING);
 
+  appliances.addSignature("fridge", 167);
+  appliances.addSignature("heater", 1020);
+  appliances.addSignature("wh_lower", 3674);
+  appliances.addSignature("wh_upper", 4483);
+
+  // Bins no more than 1/(2 * 480 min) apart in frequency.
+  cycles.addBand("fridge", 11, 15, 24);
+  heaterBand = cycles.addBand("heater", 50, 80, 8);
+
   sensors.setWaitForConversion(false);
 
   //Set resolution.
@@ -102,56 +415,60 @@ void setup() {
     else if (error == OTA_END_ERROR) Serial.println("End Failed");
   });
   
+  budget.radioOn(millis());
   wifiConnect();
   mqttConnect();
   ArduinoOTA.setHostname("pwrmtr");
   ArduinoOTA.begin();
+
+  if (LittleFS.begin()) {
+    spill.begin();
+  }
 }
 
 void loop() {
-  if (WiFi.status() != WL_CONNECTED) {
-    wifiConnect();
+  budget.update(millis());
+
+  // Never blocks: pulses, windows and publishOrStore() go on while the AP
+  // is down.
+  if (!radioAsleep && wifi.service()) {
+    if (!mqtt.connected()) {
+      mqttConnect();
+    }
+    if (wakePending && mqtt.connected()) {
+      finishWake();
+    }
   }
 
-  if (!mqtt.connected()) {
-    mqttConnect();
+  // Drain every queued pulse in order, so a slow loop() no longer merges them.
+  uint32_t pulseTime;
+  while (pulses.pop(pulseTime)) {
+    handlePulse(pulseTime);
   }
 
-  if (wPulse) {
-    unsigned long dt = wNewTime - wOldTime;
-    
-    // Debounce: Reject pulses faster than 100ms (100,000 µs).
-    // 100A service @ 240V = 24kW max. 100ms = 36kW equivalent.
-    // Any pulse below this threshold is physically impossible and
-    // is an optical double-trigger from the IR test port.
-    if (!firstRun && dt < 100000) {
-      // Log rejected pulse for diagnostics, do NOT update wOldTime
-      mqtt.publish("power/rejected", String(3600000000.0 / (float)dt, 2).c_str());
-      wPulse = false;
-    } else if (!firstRun) {
-      // 1Wh per pulse. 3600s * 1,000,000us / dt
-      float currentW = 3600000000.0 / (float)dt;
+  window10s.tick(millis());
+  window1m.tick(millis());
+  window15m.tick(millis());
 
-      mqtt.publish("power/W", String(currentW, 2).c_str());
+  uint32_t nowUs = micros();
+  if (estimator.checkStepDown(nowUs)) {
+    mqtt.publish("power/stepdown", String(estimator.estimate(nowUs)).c_str());
+  }
+  if (estimator.decaying(nowUs) && millis() - lastEstimate > ESTIMATE_INTERVAL_MS) {
+    lastEstimate = millis();
+    mqtt.publish("power/estimate", String(estimator.estimate(nowUs)).c_str());
+  }
 
-      wOldTime = wNewTime;
-      digitalWrite(0, !digitalRead(0));
-      wPulse = false;
-    } else {
-      // First pulse after startup — establish baseline, no publish
-      firstRun = false;
-      wOldTime = wNewTime;
-      digitalWrite(0, !digitalRead(0));
-      wPulse = false;
-    }
+  if (pulses.overflows() != reportedOverflows) {
+    reportedOverflows = pulses.overflows();
+    mqtt.publish("pwrmtr/pulse/overflows", String(reportedOverflows).c_str(), true);
   }
 
-  if (millis() - lastTemp > 15000) {
+  if (!radioAsleep && millis() - lastTemp > 15000) {
     //Send temp date every 30 seconds.
     lastTemp = millis();
 
-    //Rescan the 1Wire bus, hot swap devices without power cycling.
-    sensors.begin();
+    discoverSensors();
 
     //Non blocking temp conversion.
     conversionInProgress = true;
@@ -162,30 +479,15 @@ void loop() {
   if (conversionInProgress) {
         //if (sensors.isConversionComplete()) {
     if (millis() > lastTemp + 2000) {
-      //Send address and value for all devices.
-      int sensorCount = sensors.getDeviceCount();
-
-      for (int val = 0; val < sensorCount; val++) {
-        uint8_t addr[8];
-        sensors.getAddress(addr, val);
-        String address = "temp/";
-        for (uint8_t i = 0; i < 8; i++)
-        {
-          // zero pad the address if necessary
-          if (addr[i] < 16) address = address + String(0);
-            address = address + String(addr[i], HEX);
-         }
-
-        float temp = sensors.getTempFByIndex(val);
-
-        if (temp > -196.6 && temp < 185) {
-          mqtt.publish(address.c_str(), String(temp).c_str());
-        }
-      }
+      tempSensors.read(sensors, millis(), publishTemp);
       conversionInProgress = false;
     }
   }
 
+  if (online() && !store.empty()) {
+    store.publishReplay(millis() / 1000);
+  }
+
   // Battery monitoring
   if (millis() - lastBattRead > BATT_READ_INTERVAL_MS || lastBattRead == 0) {
     lastBattRead = millis();
@@ -206,17 +508,40 @@ void loop() {
     // Calculate percentage (clamped 0-100)
     float percent = (battVoltage - BATT_V_MIN) / (BATT_V_MAX - BATT_V_MIN) * 100.0;
     battPercent = (int)constrain(percent, 0, 100);
-    
+
+    bool low = battVoltage > 0 && battPercent < LOW_BATT_PERCENT;
+    if (!low) lowBattReported = false;
+
     // Publish battery state
-    if (battVoltage > 0) {
+    if (battVoltage > 0 && online()) {
       char buf[16];
       snprintf(buf, sizeof(buf), "%.2f", battVoltage);
       mqtt.publish("pwrmtr/battery/voltage", buf, true);
       snprintf(buf, sizeof(buf), "%d", battPercent);
       mqtt.publish("pwrmtr/battery/percent", buf, true);
+      publishBudget();
+      if (low) lowBattReported = true;
+    } else if (low && !lowBattReported) {
+      wakeRequested = true;
     }
   }
-  
+
+  // Radio duty cycling.
+  if (powerSave) {
+    if (radioAsleep) {
+      unsigned long sinceWake = millis() - lastWake;
+      if (sinceWake >= POWER_SAVE_FLUSH_INTERVAL_MS || (wakeRequested && sinceWake >= POWER_SAVE_MIN_WAKE_GAP_MS)) {
+        radioWake();
+      }
+    } else if (wakePending ? millis() - lastWake > WAKE_TIMEOUT_MS
+                           : millis() - lastWake > POWER_SAVE_AWAKE_MS && !conversionInProgress) {
+      // A failed wake keeps the batch for the next one.
+      radioSleep();
+    }
+  } else if (radioAsleep) {
+    radioWake();
+  }
+
   mqtt.loop();
   ArduinoOTA.handle();
 }
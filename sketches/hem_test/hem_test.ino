@@ -5,7 +5,10 @@
  * Purpose: Displays power consumption, temperature, and HVAC status on OLED screen
  * 
  * MQTT Topics:
- *   Subscribe: power/W, temp/tempF, hvac/state
+ *   Subscribe: power/10s, temp/tempF, hvac/state
+ *   Publish: test/oled/bytes, test/oled/flush_us (per frame, minute average),
+ *            test/oled/frames, test/oled/changes (per minute),
+ *            test/oled/service_us_max (longest display.service() in the minute)
  * 
  * Dependencies:
  *   - ESP8266WiFi
@@ -21,6 +24,7 @@
 #include <PubSubClient.h>
 #include <Wire.h>
 #include "SSD1306.h"
+#include "SSD1306Widgets.h"
 
 #define OLED_SDA 4  // pin 14
 #define OLED_SDC 5  // pin 12
@@ -35,50 +39,22 @@ const char* server = "raspberrypi";
 const char* ssid = "Mitchell";
 const char* password = "easypassword";
 
-int power, temp, icon;
+// MQTT messages only set values; loop() renders what changed at most
+// OLED_FPS times a second, however fast they arrive.
+#define OLED_FPS 10
+
+// display() only copies the frame aside; display.service() sends at most
+// this many I2C bytes of it per loop(), about 1.5 ms at 400 kHz, so MQTT
+// and OTA never wait the ~3 ms of a whole flush.
+#define OLED_FLUSH_BUDGET 64
+
+// Flush cost, published once a minute.
+#define OLED_STATS_MS 60000
+unsigned long flushes = 0, flushBytes = 0, flushUs = 0, changes = 0, lastOledStats = 0;
 
 const uint8_t READY = 1, NEXTBTN = 2;
 uint8_t state = READY;
 
-void callback(char* topic, byte* payload, unsigned int length) {
-  String payloads;
-  for (int i = 0; i < length; i++) {
-    payloads += (char)payload[i];
-  }
-  
-  if (strcmp(topic, "power/W") == 0) {
-    int thisNumber = payloads.toInt();
-    if (thisNumber > 0) {
-      power = thisNumber;
-      draw();
-    }
-  }
-  
-  if (strcmp(topic, "temp/tempF") == 0) {
-    int thisNumber = payloads.toInt();
-    if (thisNumber > 0) {
-      temp = thisNumber;
-      draw();
-    }
-  }
-  
-  if (strcmp(topic, "hvac/state") == 0) {
-    if (strcmp(payloads.c_str(), "CoolReady") == 0 || strcmp(payloads.c_str(), "HeatReady") == 0) {
-      icon = 0;
-    }
-    if (strcmp(payloads.c_str(), "CoolOn") == 0 || strcmp(payloads.c_str(), "Cooling") == 0) {
-      icon = 1;
-    }
-    if (strcmp(payloads.c_str(), "HeatOn") == 0 || strcmp(payloads.c_str(), "Heating") == 0) {
-      icon = 2;
-    }
-    if (strcmp(payloads.c_str(), "FanWait") == 0 || strcmp(payloads.c_str(), "Wait") == 0) {
-      icon = 3;
-    }
-    draw();
-  }
-}
-
 // Icon bitmaps for HVAC status
 static char cool[] = {
   0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
@@ -218,33 +194,71 @@ static char waiting[] = {
   0x40, 0x92, 0x24, 0x49, 0x92, 0x24, 0x49, 0x02
 };
 
-void draw() {
-  if (state == READY) {
-    display.clear();
-
-    // Show power consumption
-    display.drawString(0, 0, String(power) + " W");
+// Power and temperature on the left, the HVAC status icon on the right.
+// Icon 0 (ready) is blank.
+const char* const hvacIcons[] = {NULL, cool, heat, waiting};
+SSD1306ValueWidget power(0, 0, 63, 19, ArialMT_Plain_16_Font, " W");
+SSD1306ValueWidget temp(0, 19, 63, 19, ArialMT_Plain_16_Font, " F");
+SSD1306IconWidget hvacIcon(63, 0, 64, 64, hvacIcons, 4);
+SSD1306Screen screen(&display);
 
-    // Show temperature
-    display.drawString(0, 19, String(temp) + " F");
-
-    // Show HVAC status icon
-    switch (icon) {
-      case 0:  // Ready - no icon
-        break;
-      case 1:  // Cooling
-        display.drawXbm(63, 0, 64, 64, cool);
-        break;
-      case 2:  // Heating
-        display.drawXbm(63, 0, 64, 64, heat);
-        break;
-      case 3:  // Waiting
-        display.drawXbm(63, 0, 64, 64, waiting);
-        break;
+void callback(char* topic, byte* payload, unsigned int length) {
+  String payloads;
+  for (int i = 0; i < length; i++) {
+    payloads += (char)payload[i];
+  }
+  
+  // hem_pwrmtr's 10 s window: {"kwh":..,"w":<mean W>,...}
+  if (strcmp(topic, "power/10s") == 0) {
+    int at = payloads.indexOf("\"w\":");
+    int thisNumber = at < 0 ? 0 : payloads.substring(at + 4).toInt();
+    if (thisNumber > 0 && power.set(thisNumber)) changes++;
+  }
+  
+  if (strcmp(topic, "temp/tempF") == 0) {
+    int thisNumber = payloads.toInt();
+    if (thisNumber > 0 && temp.set(thisNumber)) changes++;
+  }
+  
+  if (strcmp(topic, "hvac/state") == 0) {
+    uint8_t next = hvacIcon.get();
+    if (strcmp(payloads.c_str(), "CoolReady") == 0 || strcmp(payloads.c_str(), "HeatReady") == 0) {
+      next = 0;
+    }
+    if (strcmp(payloads.c_str(), "CoolOn") == 0 || strcmp(payloads.c_str(), "Cooling") == 0) {
+      next = 1;
+    }
+    if (strcmp(payloads.c_str(), "HeatOn") == 0 || strcmp(payloads.c_str(), "Heating") == 0) {
+      next = 2;
     }
+    if (strcmp(payloads.c_str(), "FanWait") == 0 || strcmp(payloads.c_str(), "Wait") == 0) {
+      next = 3;
+    }
+    if (hvacIcon.set(next)) changes++;
+  }
+}
+
+void draw() {
+  if (state == READY) screen.update();
+  if (!display.service()) return;
+  flushes++;
+  flushBytes += display.getLastFlushBytes();
+  flushUs += display.getLastFlushMicros();
+}
 
-    display.display();
+// Average I2C bytes and time per frame over the last minute, how many value
+// changes those frames carried, and the longest a loop() spent flushing.
+void reportOledStats() {
+  if (millis() - lastOledStats < OLED_STATS_MS || !mqtt.connected()) return;
+  lastOledStats = millis();
+  mqtt.publish("test/oled/frames", String(flushes).c_str());
+  mqtt.publish("test/oled/changes", String(changes).c_str());
+  if (flushes > 0) {
+    mqtt.publish("test/oled/bytes", String(flushBytes / flushes).c_str());
+    mqtt.publish("test/oled/flush_us", String(flushUs / flushes).c_str());
   }
+  mqtt.publish("test/oled/service_us_max", String(display.getMaxServiceMicros()).c_str());
+  flushes = flushBytes = flushUs = changes = 0;
 }
 
 void wifiConnect() {
@@ -261,7 +275,7 @@ void mqttConnect() {
   mqtt.setServer(server, 1883);
   mqtt.setCallback(callback);
   if (mqtt.connect(WiFi.hostname().c_str())) {
-    mqtt.subscribe("power/W");
+    mqtt.subscribe("power/10s");
     mqtt.subscribe("temp/tempF");
     mqtt.subscribe("hvac/state");
   }
@@ -300,7 +314,12 @@ void setup() {
   ArduinoOTA.begin();
 
   display.init();
-  display.setFont(ArialMT_Plain_16);
+  display.setFlushBudget(OLED_FLUSH_BUDGET);
+  display.setFont(ArialMT_Plain_16_Font);
+  screen.add(&power);
+  screen.add(&temp);
+  screen.add(&hvacIcon);
+  screen.setTargetFPS(OLED_FPS);
 }
 
 void loop() {
@@ -314,6 +333,8 @@ void loop() {
 
   mqtt.loop();
   ArduinoOTA.handle();
+  draw();
+  reportOledStats();
 
   static bool btnUp = false, btnDwn = false;
   static unsigned long lastBtnUp = 0, lastBtnDwn = 0;
@@ -350,6 +371,7 @@ void loop() {
     case NEXTBTN:
       if (btnUp && btnDwn) {
         state = READY;
+        screen.invalidate();
       }
       btnUp = false;
       btnDwn = false;
@@ -1,6 +1,14 @@
 #include <ESP8266WiFi.h>
 #include <ESP8266mDNS.h>
 #include <ArduinoOTA.h>
+#include <FastConnect.h>
+#include <LittleFS.h>
+#include <TelemetryStore.h>
+#include <LittleFSSpill.h>
+#include <SensorRegistry.h>
+#include <PulseRing.h>
+#include <FlowMeter.h>
+#include <RtcCounter.h>
 
 #include <PubSubClient.h>
 
@@ -21,11 +29,29 @@ const char* server = "192.168.1.2";
 const char* ssid     = "Mitchell";
 const char* password = "easypassword";
 
+FastConnect wifi(ssid, password, "wtrsft");
+
 //Time variables
 unsigned long lastTemp;
 
 boolean conversionInProgress = false;
 
+// Live readings and the replayed backlog go out through here.
+bool mqttPublish(const char* topic, const char* payload) {
+  return mqtt.connected() && mqtt.publish(topic, payload);
+}
+
+// Readings taken while the broker is unreachable, replayed on reconnect.
+LittleFSSpill spill;
+TelemetryStore store(&spill, mqttPublish);
+
+// DS18B20s by ROM with their topics preformatted. The bus is only searched
+// at boot, every SENSOR_RESCAN_MS (hot swap) and after a failed read.
+#define SENSOR_DEADBAND_F 0.2
+#define SENSOR_MAX_AGE_MS 300000
+#define SENSOR_RESCAN_MS 300000
+SensorRegistry tempSensors("temp/", SENSOR_DEADBAND_F, SENSOR_MAX_AGE_MS, SENSOR_RESCAN_MS);
+
 void callback(char* topic, byte* payload, unsigned int length) {
   String payloads;
   for (int i = 0; i < length; i++) {
@@ -34,30 +60,81 @@ void callback(char* topic, byte* payload, unsigned int length) {
 }
 
 void wifiConnect() {
-  WiFi.mode(WIFI_STA);
-  WiFi.hostname("wtrsft");
-  WiFi.begin(ssid, password);
-  while (WiFi.status() != WL_CONNECTED) {
-    delay(200);
-    digitalWrite(2, !digitalRead(2));
-  }
-  digitalWrite(2, 1);
+  // Cached BSSID/channel/IP join, full scan only if that fails.
+  wifi.connect();
 }
 
 void mqttConnect() {
   mqtt.setServer(server, 1883);
   mqtt.setCallback(callback);
   if (mqtt.connect(WiFi.hostname().c_str())) {
+    wifi.report(mqtt);
+  }
+}
+
+void discoverSensors() {
+  // Cost of the last read cycle, to keep an eye on it.
+  if (tempSensors.rescan(sensors, millis()) && mqtt.connected() && tempSensors.cycleUs()) {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%lu", (unsigned long)tempSensors.cycleUs());
+    mqtt.publish("wtrsft/temp/cycle_us", buf, true);
   }
 }
 
+void publishTemp(const char* topic, float value) {
+  store.publishOrStore(topic, value, 2, millis() / 1000);
+}
+
 #define GPM_SENSOR 13
 
-volatile unsigned int gpmPulse = 0;
-unsigned long gpmNewTime, gpmOldTime;
+// Pulse timestamps (micros) from the ISR; 64 is ~4 s of backlog at 5 GPM.
+PulseRing<64> flowPulses;
+uint32_t reportedFlowOverflows = 0;
+
+// Rate, draws and leaks from the pulse stream. GPM goes out every
+// FLOW_PUBLISH_MS while water runs and once as 0 when it stops.
+#define FLOW_PUBLISH_MS 2000
+void publishFlowEvent(const FlowEvent& e);
+FlowMeter flow(publishFlowEvent);
+unsigned long lastFlowPublish = 0;
+bool flowPublished = false;
+bool reportedLeak = false;
+float leakGph = 0;
+
+// Lifetime pulse count, kept across resets in RTC blocks 8-9 (README.md).
+#define TOTALIZER_RTC_BLOCK 8
+#define TOTAL_PUBLISH_MS 60000
+RtcCounter totalizer(TOTALIZER_RTC_BLOCK);
+uint32_t savedTotal = 0;
+uint32_t publishedTotal = 0;
+unsigned long lastTotalPublish = 0;
 
 ICACHE_RAM_ATTR void gpmPulsed() {
-  gpmPulse++;
+  flowPulses.push(micros());
+}
+
+void publishFlowEvent(const FlowEvent& e) {
+  if (e.kind == FLOW_LEAK || e.kind == FLOW_LEAK_CLEAR) {
+    // Average rate over the whole stretch without a quiet gap; published
+    // from loop() so a leak found while offline still goes out.
+    leakGph = e.milliGallons * 3600.0 / e.durationMs;
+    return;
+  }
+  if (!mqtt.connected()) return;
+
+  char buf[96];
+  switch (e.kind) {
+    case FLOW_DRAW_START:
+      mqtt.publish("water/draw", "{\"edge\":\"start\"}");
+      break;
+    case FLOW_DRAW_END:
+      snprintf(buf, sizeof(buf), "{\"edge\":\"end\",\"gal\":%.3f,\"s\":%lu,\"peak_gpm\":%.2f}",
+               e.milliGallons / 1000.0, (unsigned long)(e.durationMs / 1000), e.peakMilliGpm / 1000.0);
+      mqtt.publish("water/draw", buf);
+      break;
+    default:
+      break;
+  }
 }
 
 // UDP Removed - Stub function to allow compilation if calls exist
@@ -70,14 +147,17 @@ void setup() {
   
   pinMode(2, OUTPUT);
   digitalWrite(2, 0);
+  wifi.setStatusLed(2);
 
   //Enable external interrupt of digital I/O pin 11
   pinMode(GPM_SENSOR, INPUT_PULLUP);
   attachInterrupt(GPM_SENSOR, gpmPulsed, FALLING);
-  gpmOldTime = millis();
+
+  if (totalizer.load(savedTotal)) {
+    flow.setTotalPulses(savedTotal);
+  }
 
   sensors.setWaitForConversion(false);
-  sensors.begin(); // Start 1-Wire bus once at startup
 
   ArduinoOTA.onStart([]() {
     Serial.println("Start");
@@ -103,46 +183,67 @@ void setup() {
   mqttConnect();
   ArduinoOTA.setHostname("wtrsft");
   ArduinoOTA.begin();
+
+  if (LittleFS.begin()) {
+    spill.begin();
+  }
 }
 
 void loop() {
+  // Never blocks: sampling and publishOrStore() go on while the AP is down.
+  if (wifi.service() && !mqtt.connected()) {
+    mqttConnect();
+  }
 
-  if (WiFi.status() != WL_CONNECTED) {
-    wifiConnect();
+  uint32_t pulseUs;
+  while (flowPulses.pop(pulseUs)) {
+    // Pulse time on the millis() clock (it may have sat in the ring a while).
+    flow.pulse(millis() - (micros() - pulseUs) / 1000, pulseUs);
   }
+  flow.tick(millis());
 
-  if (!mqtt.connected()) {
-    mqttConnect();
+  if (flow.totalPulses() != savedTotal) {
+    savedTotal = flow.totalPulses();
+    totalizer.save(savedTotal);
+  }
+  if (savedTotal != publishedTotal && millis() - lastTotalPublish > TOTAL_PUBLISH_MS && mqtt.connected()) {
+    lastTotalPublish = millis();
+    publishedTotal = savedTotal;
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%lu.%03lu", (unsigned long)(savedTotal / FLOW_PULSES_PER_GALLON),
+             (unsigned long)(savedTotal % FLOW_PULSES_PER_GALLON * FLOW_MGAL_PER_PULSE));
+    mqtt.publish("water/total_gal", buf, true);
   }
 
-    unsigned int currentPulses;
-    noInterrupts();
-    currentPulses = gpmPulse;
-    if (currentPulses >= 50) {
-      gpmPulse -= 50;
-      interrupts();
-      
-      gpmNewTime = millis();
-      unsigned long duration = gpmNewTime - gpmOldTime;
-      
-      // Compute GPM. 200 pulses per gallon. Send GPM every quart (50 pulses).
-      // Safety: Prevent division by zero and handle very fast pulses
-      if (duration > 0) {
-        float currentGPM = 15000.0 / duration;
-        String valStr = String(currentGPM);
-        mqtt.publish("water/GPM", valStr.c_str());
-      }
-
-      gpmOldTime = gpmNewTime;
-    } else {
-      interrupts();
-    }
+  if (flow.drawing() && millis() - lastFlowPublish > FLOW_PUBLISH_MS) {
+    lastFlowPublish = millis();
+    flowPublished = true;
+    store.publishOrStore("water/GPM", flow.milliGpm(millis(), micros()) / 1000.0, 2, millis() / 1000);
+  } else if (!flow.drawing() && flowPublished) {
+    flowPublished = false;
+    store.publishOrStore("water/GPM", 0, 2, millis() / 1000);
+  }
+
+  if (flow.leaking() != reportedLeak && mqtt.connected()) {
+    reportedLeak = flow.leaking();
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%.2f", leakGph);
+    mqtt.publish("water/leak/gph", buf, true);
+    mqtt.publish("water/leak", reportedLeak ? "1" : "0", true);
+  }
+
+  if (flowPulses.overflows() != reportedFlowOverflows && mqtt.connected()) {
+    reportedFlowOverflows = flowPulses.overflows();
+    mqtt.publish("wtrsft/pulse/overflows", String(reportedFlowOverflows).c_str(), true);
+  }
 
     if (millis() - lastTemp > 15000) {
     //Send temp date every 30 seconds.
     lastTemp = millis();
 
       
+    discoverSensors();
+
     //Non blocking temp conversion.
     conversionInProgress = true;
     sensors.requestTemperatures();
@@ -152,31 +253,15 @@ void loop() {
   if (conversionInProgress) {
     //    if (sensors.isConversionAvailable(0)) {
     if (millis() > lastTemp + 2000) {
-      //Send address and value for all devices.
-      int sensorCount = sensors.getDeviceCount();
-
-      for (int val = 0; val < sensorCount; val++) {
-        uint8_t addr[8];
-        sensors.getAddress(addr, val);
-        String address = "temp/";
-        for (uint8_t i = 0; i < 8; i++)
-        {
-          // zero pad the address if necessary
-          if (addr[i] < 16) address = address + String(0);
-          address = address + String(addr[i], HEX);
-        }
-
-        float temp = sensors.getTempFByIndex(val);
-
-        if (temp > -196.6 && temp < 185) {
-          String valStr = String(temp);
-          mqtt.publish(address.c_str(), valStr.c_str());
-        }
-      }
+      tempSensors.read(sensors, millis(), publishTemp);
       conversionInProgress = false;
     }
   }
 
+  if (mqtt.connected() && !store.empty()) {
+    store.publishReplay(millis() / 1000);
+  }
+
   MDNS.update();
   mqtt.loop();
   ArduinoOTA.handle();
@@ -1,11 +1,23 @@
 const API_BASE = '/api';
 
+const POLL_INTERVAL = 3000;
+const PUSH_TIMEOUT = 40000; // Heartbeats come every 15 s
+const HISTORY_SPAN = 86400;
+const HISTORY_REFRESH = 300000;
+
 // State
 let currentData = null;
 let optimisticTarget = null;
 let updateTimer = null;
 let lastUptime = 0;
 
+// Push channel: /api/events sends the whole status on connect, then only
+// what changed. Polling takes over whenever it's down.
+let events = null;
+let pushLive = false;
+let pushWatchdog = null;
+let pollTimer = null;
+
 async function fetchStatus() {
     try {
         const res = await fetch(`${API_BASE}/status`);
@@ -20,6 +32,65 @@ async function fetchStatus() {
     }
 }
 
+function startPolling() {
+    if (pollTimer) return;
+    fetchStatus();
+    pollTimer = setInterval(fetchStatus, POLL_INTERVAL);
+}
+
+function stopPolling() {
+    if (!pollTimer) return;
+    clearInterval(pollTimer);
+    pollTimer = null;
+}
+
+// Nothing heard for PUSH_TIMEOUT: the stream is stuck, start over
+function kickPushWatchdog() {
+    if (pushWatchdog) clearTimeout(pushWatchdog);
+    pushWatchdog = setTimeout(() => {
+        pushLive = false;
+        startPolling();
+        if (events) events.close();
+        connectPush();
+    }, PUSH_TIMEOUT);
+}
+
+// Merge a partial status into currentData; "hal" is merged a level down
+function applyDelta(delta) {
+    if (!currentData) return;
+    const { hal, ...top } = delta;
+    Object.assign(currentData, top);
+    if (hal) currentData.hal = Object.assign(currentData.hal || {}, hal);
+    updateUI(currentData);
+}
+
+function connectPush() {
+    events = new EventSource(`${API_BASE}/events`);
+
+    events.addEventListener('status', (e) => {
+        currentData = JSON.parse(e.data);
+        updateUI(currentData);
+        pushLive = true;
+        stopPolling();
+        setConnected(true);
+        kickPushWatchdog();
+    });
+    events.addEventListener('delta', (e) => {
+        applyDelta(JSON.parse(e.data));
+        kickPushWatchdog();
+    });
+    events.addEventListener('ping', (e) => {
+        applyDelta(JSON.parse(e.data));
+        setConnected(true);
+        kickPushWatchdog();
+    });
+    events.onerror = () => {
+        // EventSource reconnects by itself and gets a fresh "status"
+        pushLive = false;
+        startPolling();
+    };
+}
+
 function setConnected(connected) {
     const status = document.getElementById('connStatus');
     const dot = document.getElementById('connDot');
@@ -104,7 +175,7 @@ async function setMode(mode) {
             headers: { 'Content-Type': 'application/json' },
             body: JSON.stringify({ mode: mode })
         });
-        if (res.ok) fetchStatus();
+        if (res.ok && !pushLive) fetchStatus();
     } catch (e) {
         console.error("Set mode failed:", e);
     }
@@ -135,7 +206,13 @@ async function adjustTemp(delta) {
             });
             if (res.ok) {
                 optimisticTarget = null;
-                fetchStatus();
+                // The delta may have come before the response
+                if (pushLive) {
+                    currentData.target = newTemp;
+                    updateUI(currentData);
+                } else {
+                    fetchStatus();
+                }
             }
         } catch (e) {
             console.error("Set target failed:", e);
@@ -143,6 +220,77 @@ async function adjustTemp(delta) {
     }, 800);
 }
 
+// Chart of the last HISTORY_SPAN from /api/history, a point per pixel
+async function fetchHistory() {
+    const canvas = document.getElementById('historyChart');
+    const points = Math.min(500, Math.max(3, Math.round(canvas.clientWidth)));
+    try {
+        const res = await fetch(`${API_BASE}/history?from=-${HISTORY_SPAN}&points=${points}`);
+        if (!res.ok) return;
+        drawHistory(canvas, parseHistory(await res.text()));
+    } catch (e) {
+        console.error("History fetch failed:", e);
+    }
+}
+
+function parseHistory(csv) {
+    return csv.trim().split('\n').slice(1).map(line => {
+        const [time, temp, target, heat, cool] = line.split(',').map(v => v === '' ? null : Number(v));
+        return { time, temp, target, heat, cool };
+    });
+}
+
+// Temperature over target, shaded while heating or cooling
+function drawHistory(canvas, rows) {
+    const w = canvas.clientWidth;
+    const h = canvas.clientHeight;
+    const dpr = window.devicePixelRatio || 1;
+    canvas.width = w * dpr;
+    canvas.height = h * dpr;
+    const ctx = canvas.getContext('2d');
+    ctx.scale(dpr, dpr);
+    if (rows.length < 2) return;
+
+    const t0 = rows[0].time;
+    const span = Math.max(1, rows[rows.length - 1].time - t0);
+    const values = rows.flatMap(r => r.temp === null ? [r.target] : [r.temp, r.target]);
+    const lo = Math.min(...values) - 1;
+    const hi = Math.max(...values) + 1;
+    const x = t => (t - t0) / span * w;
+    const y = v => h - (v - lo) / (hi - lo) * h;
+
+    rows.forEach((r, i) => {
+        const duty = Math.max(r.heat, r.cool);
+        if (!duty || i + 1 === rows.length) return;
+        ctx.fillStyle = r.heat >= r.cool
+            ? `rgba(255, 149, 0, ${0.3 * duty})`
+            : `rgba(0, 122, 255, ${0.3 * duty})`;
+        ctx.fillRect(x(r.time), 0, Math.max(1, x(rows[i + 1].time) - x(r.time)), h);
+    });
+    drawLine(ctx, rows, 'target', x, y, 'rgba(255, 255, 255, 0.35)');
+    drawLine(ctx, rows, 'temp', x, y, '#ffffff');
+}
+
+// Broken where the value is unknown
+function drawLine(ctx, rows, key, x, y, color) {
+    ctx.strokeStyle = color;
+    ctx.lineWidth = 1.5;
+    ctx.beginPath();
+    let drawing = false;
+    rows.forEach(r => {
+        if (r[key] === null) {
+            drawing = false;
+            return;
+        }
+        if (drawing) ctx.lineTo(x(r.time), y(r[key]));
+        else ctx.moveTo(x(r.time), y(r[key]));
+        drawing = true;
+    });
+    ctx.stroke();
+}
+
 // Initialize
-fetchStatus();
-setInterval(fetchStatus, 3000); // Background refresh
+startPolling(); // Until the push channel is up
+if (window.EventSource) connectPush();
+fetchHistory();
+setInterval(fetchHistory, HISTORY_REFRESH);
@@ -1,6 +1,7 @@
 #include "engine.h"
 #include "hal.h"
 #include "config.h"
+#include "history.h"
 #include <ArduinoJson.h>
 
 // ==========================================
@@ -11,6 +12,7 @@ ThermoState _currentState = STATE_IDLE;
 Preferences _prefs;
 unsigned long _lastSaveRequest = 0;
 bool _savePending = false;
+uint32_t _engineVersion = 0; // Bumped on any change the UI shows
 
 float _targetTemp = 68.0;      
 float _remoteTemp = NAN;
@@ -31,11 +33,13 @@ void ThermoEngine::init() {
     Serial.println("[Engine] Initializing Logic...");
     _loadSettings();
     _stateStartTime = millis();
+    History::init();
 }
 
 void ThermoEngine::update() {
     _validateInternalState();
     HAL::ping(); // Heartbeat to prevent HAL failsafe
+    History::update();
     unsigned long now = millis();
     if (now - _lastLogicRun < LOGIC_INTERVAL) return;
     _lastLogicRun = now;
@@ -46,7 +50,7 @@ void ThermoEngine::update() {
     }
 
     // 1. Get Temperature
-    float currentTemp = _getEffectiveTemp();
+    float currentTemp = getEffectiveTemp();
 
     // 2. Validate Input
     if (isnan(currentTemp)) {
@@ -85,6 +89,7 @@ void ThermoEngine::setMode(ThermoMode mode) {
 
         // Force immediate logic re-eval
         _lastLogicRun = 0; 
+        _engineVersion++;
     }
 }
 
@@ -94,6 +99,7 @@ void ThermoEngine::setTargetTemp(float tempF) {
         _targetTemp = tempF; 
         _savePending = true;
         _lastSaveRequest = millis();
+        _engineVersion++;
     }
 }
 float ThermoEngine::getTargetTemp() { return _targetTemp; }
@@ -101,11 +107,17 @@ float ThermoEngine::getTargetTemp() { return _targetTemp; }
 void ThermoEngine::provideRemoteTemp(float tempF) {
     _remoteTemp = tempF;
     _lastRemoteUpdate = millis();
+    _engineVersion++;
 }
 
 ThermoState ThermoEngine::getState() { return _currentState; }
+uint32_t ThermoEngine::getVersion() { return _engineVersion; }
 
-float ThermoEngine::_getEffectiveTemp() {
+bool ThermoEngine::isUsingRemote() {
+    return millis() - _lastRemoteUpdate < REMOTE_TIMEOUT && !isnan(_remoteTemp);
+}
+
+float ThermoEngine::getEffectiveTemp() {
     if (millis() - _lastRemoteUpdate < REMOTE_TIMEOUT && !isnan(_remoteTemp) && _remoteTemp > -50) {
         return _remoteTemp;
     }
@@ -163,6 +175,7 @@ void ThermoEngine::_changeState(ThermoState newState) {
     }
 
     _currentState = effectiveState;
+    _engineVersion++;
 }
 
 void ThermoEngine::_processLogic(float t) {
@@ -228,11 +241,11 @@ void ThermoEngine::populateStatusJson(JsonDocument& doc) {
     doc["state"] = (int)_currentState;
     doc["target"] = _targetTemp;
     
-    float et = _getEffectiveTemp();
+    float et = getEffectiveTemp();
     if (isnan(et)) doc["effTemp"] = nullptr;
     else doc["effTemp"] = et;
     
-    doc["usingRemote"] = (millis() - _lastRemoteUpdate < REMOTE_TIMEOUT && !isnan(_remoteTemp));
+    doc["usingRemote"] = isUsingRemote();
 }
     
 void ThermoEngine::_validateInternalState() {
@@ -40,12 +40,18 @@ public:
     static void provideRemoteTemp(float tempF);
     
     static ThermoState getState();
+
+    // Remote temperature while fresh, else the local sensor; NAN if neither
+    static float getEffectiveTemp();
+    static bool isUsingRemote();
+
+    // Bumped whenever the mode, state, target or remote temperature changes
+    static uint32_t getVersion();
     
     // Updated to use JsonDocument reference
     static void populateStatusJson(JsonDocument& doc);
 
 private:
-    static float _getEffectiveTemp(); 
     static void _processLogic(float currentTemp);
     static void _changeState(ThermoState newState);
     static void _validateInternalState();
@@ -5,6 +5,7 @@
 #include <DallasTemperature.h>
 #include <esp_task_wdt.h>
 #include <esp_arduino_version.h>
+#include <atomic>
 
 // ==========================================
 // Globals
@@ -17,13 +18,39 @@ unsigned long _relayLastOffTime[RELAY_COUNT] = {0};
 unsigned long _relayStartTime[RELAY_COUNT] = {0};   
 unsigned long _lastCommandTime = 0; 
 bool _failsafeTriggered = false; // Track active failsafe state
+uint32_t _halVersion = 0; // Bumped on any change the UI shows
 
+// The loop's copy of the latest sample
 float _lastTempF = NAN; 
-unsigned long _lastTempRead = 0;
 bool _sensorValid = false;
+SensorSample _sample = {};
 const unsigned long TEMP_READ_INTERVAL = 5000; 
+const unsigned long SENSOR_STALE_MS = 3 * TEMP_READ_INTERVAL; // No sample for this long: invalid
 #define WDT_TIMEOUT 8 
 
+// The sensor task runs on the core loop() doesn't, so the 1-Wire bus
+// (interrupts masked for every bit) never holds up the control loop
+#define SENSOR_TASK_CORE  0
+#define SENSOR_TASK_STACK 4096
+#define SENSOR_TASK_PRIO  1
+TaskHandle_t _sensorTaskHandle = NULL;
+
+// Seqlock: the sensor task makes _sampleSeq odd, writes _published and
+// makes it even again. A read that saw it odd or changed is discarded
+std::atomic<uint32_t> _sampleSeq(0);
+SensorSample _published = {};
+
+// loop() timing over the last LOOP_STATS_WINDOW_MS
+#define LOOP_STATS_WINDOW_MS 10000
+uint32_t _loopLastUs = 0;
+unsigned long _loopWindowStart = 0;
+uint32_t _loopWindowMax = 0;
+uint32_t _loopWindowSum = 0;
+uint32_t _loopWindowCount = 0;
+uint32_t _loopMaxUs = 0;
+uint32_t _loopAvgUs = 0;
+uint32_t _loopWorstUs = 0;
+
 const int _relayPins[RELAY_COUNT] = {
     PIN_RELAY_HEAT, PIN_RELAY_COOL, PIN_RELAY_FAN,
     PIN_OVERRIDE_HEAT, PIN_OVERRIDE_FAN, PIN_OVERRIDE_COOL
@@ -52,9 +79,8 @@ void HAL::init() {
     pinMode(PIN_LED_STATUS, OUTPUT);
     digitalWrite(PIN_LED_STATUS, LOW); 
 
-    sensors.begin();
-    sensors.setWaitForConversion(false); 
-    sensors.requestTemperatures();       
+    xTaskCreatePinnedToCore(_sensorTask, "sensors", SENSOR_TASK_STACK, NULL,
+        SENSOR_TASK_PRIO, &_sensorTaskHandle, SENSOR_TASK_CORE);
     
     Serial.println("[HAL] Enabling Watchdog...");
 #if defined(ESP_ARDUINO_VERSION_MAJOR) && ESP_ARDUINO_VERSION_MAJOR >= 3
@@ -92,41 +118,119 @@ void HAL::update() {
         
         // Re-enforce OFF if relays somehow stuck? 
         // For now, assume allOff() worked.
-    } else {
+    } else if (_failsafeTriggered) {
         _failsafeTriggered = false;
+        _halVersion++;
     }
 
-    // 2. Temperature Reading
-    if (now - _lastTempRead >= TEMP_READ_INTERVAL) {
-        _lastTempRead = now;
-        
-        float t = sensors.getTempFByIndex(0);
+    // 2. Temperature: pick up the sensor task's latest sample
+    float lastTempF = _lastTempF;
+    bool wasValid = _sensorValid;
+    uint32_t seq = _sample.seq;
+    if (readSample(_sample) && _sample.seq != seq) {
+        _lastTempF = _sample.tempF;
+        _sensorValid = _sample.valid;
+    }
+    // Signed: the sample may have been taken after now was read
+    if (_sensorValid && (long)(now - _sample.takenAt) > (long)SENSOR_STALE_MS) {
+        Serial.println("[HAL] Sensor Stale: No sample from the sensor task.");
+        _sensorValid = false;
+        _lastTempF = NAN;
+    }
+    if (_sensorValid != wasValid || (_sensorValid && _lastTempF != lastTempF)) _halVersion++;
+
+    // 3. Loop timing
+    uint32_t nowUs = micros();
+    if (_loopLastUs) {
+        uint32_t gap = nowUs - _loopLastUs;
+        if (gap > _loopWindowMax) _loopWindowMax = gap;
+        if (gap > _loopWorstUs) _loopWorstUs = gap;
+        _loopWindowSum += gap;
+        _loopWindowCount++;
+    }
+    _loopLastUs = nowUs;
+    if (now - _loopWindowStart >= LOOP_STATS_WINDOW_MS) {
+        _loopMaxUs = _loopWindowMax;
+        _loopAvgUs = _loopWindowCount ? _loopWindowSum / _loopWindowCount : 0;
+        _loopWindowStart = now;
+        _loopWindowMax = 0;
+        _loopWindowSum = 0;
+        _loopWindowCount = 0;
+    }
+}
+
+// Wait-free: one try, and out keeps the sample it had if the sensor task
+// was writing
+bool HAL::readSample(SensorSample& out) {
+    uint32_t before = _sampleSeq.load(std::memory_order_acquire);
+    if (before & 1) return false;
+    SensorSample copy = _published;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (_sampleSeq.load(std::memory_order_relaxed) != before) return false;
+    out = copy;
+    return true;
+}
+
+void HAL::_publishSample(const SensorSample& sample) {
+    uint32_t seq = _sampleSeq.load(std::memory_order_relaxed);
+    _sampleSeq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    _published = sample;
+    _sampleSeq.store(seq + 2, std::memory_order_release);
+}
+
+// Reads the sensor every TEMP_READ_INTERVAL by its ROM address (no bus
+// search), validates the reading and publishes it
+void HAL::_sensorTask(void *param) {
+    sensors.begin();
+    sensors.setWaitForConversion(false); 
+    sensors.requestTemperatures();       
+
+    DeviceAddress addr;
+    bool found = false;
+    SensorSample sample = {};
+    sample.tempF = NAN;
+    TickType_t wake = xTaskGetTickCount();
+    for (;;) {
+        vTaskDelayUntil(&wake, pdMS_TO_TICKS(TEMP_READ_INTERVAL));
+
+        uint32_t start = micros();
+        if (!found) found = sensors.getAddress(addr, 0);
+        float t = found ? sensors.getTempF(addr) : DEVICE_DISCONNECTED_F;
         
         // Basic range check
         if (t > -50.0 && t < 150.0 && t != 185.0 && t != -196.0 && t != -127.0) {
             // Recommendation 5: Rate-of-change sanity check
             // Only apply if we already have a valid reading
-            if (_sensorValid && !isnan(_lastTempF)) {
-                float delta = abs(t - _lastTempF);
+            if (sample.valid && !isnan(sample.tempF)) {
+                float delta = abs(t - sample.tempF);
                 if (delta > 5.0) { // 5 degree jump in 5 seconds is highly unlikely for ambient air
-                    Serial.printf("[HAL] Sensor Sanity Fail: Jumped %.2f -> %.2f. Ignoring.\n", _lastTempF, t);
-                    // We don't mark invalid yet, but we don't update _lastTempF either.
+                    Serial.printf("[HAL] Sensor Sanity Fail: Jumped %.2f -> %.2f. Ignoring.\n", sample.tempF, t);
+                    // We don't mark invalid yet, but we don't update the temperature either.
                     // This allows for a single glitch to be ignored.
                 } else {
-                    _lastTempF = t;
-                    _sensorValid = true;
+                    sample.tempF = t;
+                    sample.valid = true;
                 }
             } else {
                 // First valid reading
-                _lastTempF = t;
-                _sensorValid = true;
+                sample.tempF = t;
+                sample.valid = true;
             }
         } else {
             Serial.printf("[HAL] Sensor Error: %.2f\n", t);
-            _sensorValid = false; 
-            _lastTempF = NAN; 
+            sample.valid = false; 
+            sample.tempF = NAN; 
+            sample.errors++;
+            found = false; // Search again; it may have been replaced
         }
         sensors.requestTemperatures();
+
+        sample.readMicros = micros() - start;
+        if (sample.readMicros > sample.readMaxMicros) sample.readMaxMicros = sample.readMicros;
+        sample.takenAt = millis();
+        sample.seq++;
+        _publishSample(sample);
     }
 }
 
@@ -184,6 +288,7 @@ bool HAL::setRelay(RelayID relay, bool state) {
 
     _relayState[relay] = state;
     _writeRelay(_relayPins[relay], state);
+    _halVersion++;
     
     if (state) {
         _relayStartTime[relay] = millis();
@@ -207,11 +312,34 @@ void HAL::allOff() {
     }
     // Recommendation 2: Update last command time to prevent immediate re-trigger of failsafe
     _lastCommandTime = millis(); 
+    _halVersion++;
     Serial.println("[HAL] Emergency ALL OFF");
 }
 
 float HAL::readTempF() { return _lastTempF; }
 bool HAL::isSensorValid() { return _sensorValid; }
+bool HAL::isFailsafe() { return _failsafeTriggered; }
+uint32_t HAL::getVersion() { return _halVersion; }
+
+void HAL::populateDiagJson(JsonObject& doc) {
+    JsonObject loop = doc["loop"].to<JsonObject>();
+    loop["maxUs"] = _loopMaxUs;
+    loop["avgUs"] = _loopAvgUs;
+    loop["worstUs"] = _loopWorstUs;
+
+    // Called on the web server's task: take a copy through the seqlock,
+    // _sample belongs to the loop
+    SensorSample sample = {};
+    for (int i = 0; i < 3 && !readSample(sample); i++) delay(1);
+    JsonObject sensor = doc["sensor"].to<JsonObject>();
+    sensor["seq"] = sample.seq;
+    if (sample.seq) sensor["ageMs"] = millis() - sample.takenAt;
+    else sensor["ageMs"] = nullptr;
+    sensor["readUs"] = sample.readMicros;
+    sensor["readMaxUs"] = sample.readMaxMicros;
+    sensor["errors"] = sample.errors;
+    sensor["stackFree"] = uxTaskGetStackHighWaterMark(_sensorTaskHandle);
+}
 
 void HAL::populateStatusJson(JsonObject& doc) {
     doc["uptime"] = millis() / 1000;
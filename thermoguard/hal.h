@@ -14,6 +14,17 @@ enum RelayID {
     RELAY_COUNT
 };
 
+// A validated reading, published by the sensor task
+struct SensorSample {
+    float    tempF;          // Last good reading; NAN after a failed one
+    bool     valid;
+    uint32_t takenAt;        // millis()
+    uint32_t seq;            // Samples taken so far
+    uint32_t readMicros;     // Time on the bus for this one
+    uint32_t readMaxMicros;
+    uint32_t errors;
+};
+
 class HAL {
 public:
     static void init();
@@ -28,15 +39,26 @@ public:
     // Returns NAN if invalid
     static float readTempF();
     static bool isSensorValid();
+    static bool isFailsafe();
+
+    // Copy the sensor task's latest sample, without waiting. Returns false
+    // and leaves out as it was if the task was writing it
+    static bool readSample(SensorSample& out);
+
+    // Bumped whenever a relay, the failsafe or the sensor reading changes
+    static uint32_t getVersion();
 
     static void feedWatchdog();
     
     static void populateStatusJson(JsonObject& doc);
+    static void populateDiagJson(JsonObject& doc); // Loop timing, sensor sample age
 
 private:
     static void _writeRelay(int pin, bool active);
     static bool _interlockCheck(RelayID relay, bool state);
     static bool _shortCycleCheck(RelayID relay, bool state);
+    static void _sensorTask(void *param);
+    static void _publishSample(const SensorSample& sample);
 };
 
 #endif
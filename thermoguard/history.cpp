@@ -0,0 +1,264 @@
+#include "history.h"
+#include "engine.h"
+#include "hal.h"
+
+#define MINUTE_SAMPLES  (HISTORY_MINUTE_PERIOD_S / HISTORY_RAW_PERIOD_S)
+#define QUARTER_MINUTES (HISTORY_QUARTER_PERIOD_S / HISTORY_MINUTE_PERIOD_S)
+
+static_assert(HISTORY_MINUTE_PERIOD_S % HISTORY_RAW_PERIOD_S == 0, "A minute is whole samples");
+static_assert(HISTORY_QUARTER_PERIOD_S % HISTORY_MINUTE_PERIOD_S == 0, "A quarter is whole minutes");
+
+// Running totals of the period being averaged
+struct HistorySum {
+    int32_t  temp;
+    uint16_t temps;   // Points with a known temperature
+    int32_t  target;
+    uint16_t heat;
+    uint16_t cool;
+    uint16_t fan;
+    uint16_t failsafe;
+    uint16_t points;
+};
+
+// The part of one ring a query reads
+struct HistorySpan {
+    const HistoryPoint* points;
+    uint32_t capacity;
+    uint32_t period;
+    uint32_t first;   // Ring index of the first entry
+    uint32_t count;
+};
+
+// The rings' spans, oldest first, read as one sequence
+struct HistoryView {
+    HistorySpan spans[3];
+    uint32_t    size;
+
+    HistoryRow row(uint32_t i) const;
+};
+
+// ==========================================
+// Globals
+// ==========================================
+HistoryRing<HISTORY_RAW_COUNT> _raw;
+HistoryRing<HISTORY_MINUTE_COUNT> _minutes;
+HistoryRing<HISTORY_QUARTER_COUNT> _quarters;
+HistorySum _minuteSum;
+HistorySum _quarterSum;
+
+uint32_t _historyStart = 0;       // Seconds since boot of the first sample
+unsigned long _nextSample = 0;
+SemaphoreHandle_t _historyLock;   // The loop pushes while the web server's task reads
+
+// ==========================================
+// Helpers
+// ==========================================
+
+// Middle of the period of entry index of a ring
+static uint32_t _timeOf(uint32_t index, uint32_t period) {
+    return _historyStart + index * period + (period - HISTORY_RAW_PERIOD_S) / 2;
+}
+
+static int32_t _roundDiv(int32_t sum, int32_t n) {
+    return (sum >= 0 ? sum + n / 2 : sum - n / 2) / n;
+}
+
+static void _add(HistorySum& sum, const HistoryPoint& p) {
+    if (p.temp != HISTORY_TEMP_UNKNOWN) {
+        sum.temp += p.temp;
+        sum.temps++;
+    }
+    sum.target += p.target;
+    sum.heat += p.heat;
+    sum.cool += p.cool;
+    sum.fan += p.fan;
+    sum.failsafe += p.failsafe;
+    sum.points++;
+}
+
+// Average and start over
+static HistoryPoint _take(HistorySum& sum) {
+    HistoryPoint p;
+    p.temp = sum.temps ? _roundDiv(sum.temp, sum.temps) : HISTORY_TEMP_UNKNOWN;
+    p.target = _roundDiv(sum.target, sum.points);
+    p.heat = _roundDiv(sum.heat, sum.points);
+    p.cool = _roundDiv(sum.cool, sum.points);
+    p.fan = _roundDiv(sum.fan, sum.points);
+    p.failsafe = _roundDiv(sum.failsafe, sum.points);
+    memset(&sum, 0, sizeof(sum));
+    return p;
+}
+
+static void _push(const HistoryPoint& p) {
+    _raw.push(p);
+    _add(_minuteSum, p);
+    if (_minuteSum.points < MINUTE_SAMPLES) return;
+
+    HistoryPoint minute = _take(_minuteSum);
+    _minutes.push(minute);
+    _add(_quarterSum, minute);
+    if (_quarterSum.points < QUARTER_MINUTES) return;
+
+    _quarters.push(_take(_quarterSum));
+}
+
+// The entries of ring from its oldest up to, not including, the first
+// whose time is at or after cutoff
+template <size_t N>
+static HistorySpan _span(const HistoryRing<N>& ring, uint32_t period, uint32_t cutoff) {
+    uint32_t start = _timeOf(0, period);
+    uint32_t end = cutoff <= start ? 0 : (cutoff - start - 1) / period + 1;
+    if (end > ring.count) end = ring.count;
+    uint32_t first = ring.oldest();
+    if (end < first) end = first;
+    return { ring.points, N, period, first, end - first };
+}
+
+HistoryRow HistoryView::row(uint32_t i) const {
+    const HistorySpan* s = spans;
+    while (i >= s->count) {
+        i -= s->count;
+        s++;
+    }
+    uint32_t index = s->first + i;
+    return { _timeOf(index, s->period), s->points[index % s->capacity] };
+}
+
+// First row of the view at or after time
+static uint32_t _lowerBound(const HistoryView& v, uint32_t time) {
+    uint32_t lo = 0, hi = v.size;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (v.row(mid).time < time) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+// Largest-Triangle-Three-Buckets: the first and last rows, and from each of
+// maxPoints - 2 buckets between them the row making the largest triangle
+// with the row picked before it and the average of the next bucket. Rows
+// with no temperature are only picked when a whole bucket has none, so
+// gaps stay visible
+static size_t _downsample(const HistoryView& v, uint32_t lo, uint32_t hi, size_t maxPoints, HistoryRow* out) {
+    uint32_t n = hi - lo;
+    if (n <= maxPoints) {
+        for (uint32_t i = 0; i < n; i++) out[i] = v.row(lo + i);
+        return n;
+    }
+
+    size_t written = 0;
+    out[written++] = v.row(lo);
+    uint32_t t0 = out[0].time;
+    float ax = 0;
+    float ay = out[0].point.temp == HISTORY_TEMP_UNKNOWN ? NAN : out[0].point.temp;
+
+    uint32_t buckets = maxPoints - 2;
+    uint32_t inner = n - 2;
+    for (uint32_t b = 0; b < buckets; b++) {
+        uint32_t start = lo + 1 + (uint64_t)b * inner / buckets;
+        uint32_t end = lo + 1 + (uint64_t)(b + 1) * inner / buckets;
+        uint32_t nextEnd = b + 1 < buckets ? lo + 1 + (uint64_t)(b + 2) * inner / buckets : hi;
+
+        float cx = 0, cy = 0;
+        uint32_t known = 0;
+        for (uint32_t j = end; j < nextEnd; j++) {
+            HistoryRow r = v.row(j);
+            cx += r.time - t0;
+            if (r.point.temp != HISTORY_TEMP_UNKNOWN) {
+                cy += r.point.temp;
+                known++;
+            }
+        }
+        cx /= nextEnd - end;
+        cy = known ? cy / known : NAN;
+
+        // Either end unknown: measure against the other one
+        float y0 = isnan(ay) ? cy : ay;
+        float y1 = isnan(cy) ? y0 : cy;
+        if (isnan(y0)) y0 = y1 = 0;
+
+        uint32_t pick = start;
+        float best = -1;
+        for (uint32_t i = start; i < end; i++) {
+            HistoryRow r = v.row(i);
+            if (r.point.temp == HISTORY_TEMP_UNKNOWN) continue;
+            float area = fabsf((ax - cx) * (r.point.temp - y0) - (ax - (r.time - t0)) * (y1 - y0));
+            if (area > best) {
+                best = area;
+                pick = i;
+            }
+        }
+
+        out[written] = v.row(pick);
+        ax = out[written].time - t0;
+        if (out[written].point.temp != HISTORY_TEMP_UNKNOWN) ay = out[written].point.temp;
+        written++;
+    }
+
+    out[written++] = v.row(hi - 1);
+    return written;
+}
+
+// ==========================================
+// Implementation
+// ==========================================
+
+void History::init() {
+    Serial.printf("[History] %u bytes for %u samples\n", (unsigned)HISTORY_BYTES,
+        (unsigned)(HISTORY_RAW_COUNT + HISTORY_MINUTE_COUNT + HISTORY_QUARTER_COUNT));
+    _historyLock = xSemaphoreCreateMutex();
+    unsigned long now = millis();
+    _historyStart = now / 1000;
+    _nextSample = _historyStart * 1000UL;
+}
+
+void History::update() {
+    unsigned long now = millis();
+    if ((long)(now - _nextSample) < 0) return;
+
+    HistoryPoint p;
+    _sample(p);
+
+    // A late call repeats the sample, so every ring slot stays one period
+    xSemaphoreTake(_historyLock, portMAX_DELAY);
+    do {
+        _push(p);
+        _nextSample += HISTORY_RAW_PERIOD_S * 1000UL;
+    } while ((long)(now - _nextSample) >= 0);
+    xSemaphoreGive(_historyLock);
+}
+
+uint32_t History::now() {
+    uint32_t count = _raw.count;
+    return count ? _timeOf(count - 1, HISTORY_RAW_PERIOD_S) : 0;
+}
+
+size_t History::query(uint32_t from, uint32_t to, size_t maxPoints, HistoryRow* out) {
+    if (maxPoints < 3 || from > to) return 0;
+
+    xSemaphoreTake(_historyLock, portMAX_DELAY);
+    HistoryView v;
+    uint32_t rawStart = _timeOf(_raw.oldest(), HISTORY_RAW_PERIOD_S);
+    uint32_t minuteStart = _minutes.count ? _timeOf(_minutes.oldest(), HISTORY_MINUTE_PERIOD_S) : rawStart;
+    v.spans[0] = _span(_quarters, HISTORY_QUARTER_PERIOD_S, minuteStart);
+    v.spans[1] = _span(_minutes, HISTORY_MINUTE_PERIOD_S, rawStart);
+    v.spans[2] = _span(_raw, HISTORY_RAW_PERIOD_S, UINT32_MAX);
+    v.size = v.spans[0].count + v.spans[1].count + v.spans[2].count;
+
+    uint32_t lo = _lowerBound(v, from);
+    uint32_t hi = to == UINT32_MAX ? v.size : _lowerBound(v, to + 1);
+    size_t written = lo < hi ? _downsample(v, lo, hi, maxPoints, out) : 0;
+    xSemaphoreGive(_historyLock);
+    return written;
+}
+
+void History::_sample(HistoryPoint& p) {
+    float t = ThermoEngine::getEffectiveTemp();
+    p.temp = isnan(t) ? HISTORY_TEMP_UNKNOWN : (int16_t)lroundf(t * 10);
+    p.target = (int16_t)lroundf(ThermoEngine::getTargetTemp() * 10);
+    p.heat = HAL::getRelay(RELAY_HEAT) ? 255 : 0;
+    p.cool = HAL::getRelay(RELAY_COOL) ? 255 : 0;
+    p.fan = HAL::getRelay(RELAY_FAN) ? 255 : 0;
+    p.failsafe = HAL::isFailsafe() ? 255 : 0;
+}
@@ -0,0 +1,70 @@
+#ifndef HISTORY_H
+#define HISTORY_H
+
+#include <Arduino.h>
+
+// What the thermostat did, kept at three resolutions in statically sized
+// rings: a sample every HISTORY_RAW_PERIOD_S for an hour, one-minute
+// averages for a day and 15-minute averages for a week. HISTORY_BYTES in
+// all, nothing allocated at run time.
+#define HISTORY_RAW_PERIOD_S      5
+#define HISTORY_RAW_COUNT         720    // 1 h
+#define HISTORY_MINUTE_PERIOD_S   60
+#define HISTORY_MINUTE_COUNT      1440   // 24 h
+#define HISTORY_QUARTER_PERIOD_S  900
+#define HISTORY_QUARTER_COUNT     672    // 7 days
+#define HISTORY_MAX_POINTS        500    // Most rows a query returns
+
+#define HISTORY_TEMP_UNKNOWN INT16_MIN
+
+// A sample, or the average of the samples of a period. The duties are the
+// share of samples the relay (or the failsafe) was on, 0..255, so a raw
+// sample holds 0 or 255
+struct HistoryPoint {
+    int16_t temp;      // 0.1 F effective temperature, HISTORY_TEMP_UNKNOWN if none
+    int16_t target;    // 0.1 F
+    uint8_t heat;
+    uint8_t cool;
+    uint8_t fan;
+    uint8_t failsafe;
+};
+
+// A point and the time in the middle of its period, in seconds since boot.
+// Also the little-endian row layout of /api/history?format=bin
+struct HistoryRow {
+    uint32_t     time;
+    HistoryPoint point;
+};
+
+static_assert(sizeof(HistoryRow) == 12, "HistoryRow is sent as is");
+
+template <size_t N>
+struct HistoryRing {
+    HistoryPoint points[N];
+    uint32_t     count = 0; // Ever pushed; the last N are kept
+
+    void push(const HistoryPoint& p) { points[count % N] = p; count++; }
+    uint32_t oldest() const { return count > N ? count - N : 0; }
+    const HistoryPoint& at(uint32_t i) const { return points[i % N]; }
+};
+
+#define HISTORY_BYTES (sizeof(HistoryPoint) * (HISTORY_RAW_COUNT + HISTORY_MINUTE_COUNT + HISTORY_QUARTER_COUNT))
+
+class History {
+public:
+    static void init();
+    static void update(); // Sample if one is due; called by the engine
+
+    // Time of the newest sample, 0 before the first
+    static uint32_t now();
+
+    // The rows between from and to (seconds since boot), from the finest
+    // ring that still holds each part of the range, downsampled with LTTB
+    // on the temperature to at most maxPoints. Returns the number written
+    static size_t query(uint32_t from, uint32_t to, size_t maxPoints, HistoryRow* out);
+
+private:
+    static void _sample(HistoryPoint& p);
+};
+
+#endif
@@ -87,6 +87,7 @@ void loop() {
     // 3. Network Services
     if (WiFi.status() == WL_CONNECTED) {
         ArduinoOTA.handle();
+        WebManager::update();
     }
 
     // 3. Phase 1 Test Logic: Blink Status LED
@@ -1,12 +1,115 @@
 #include "web.h"
 #include "hal.h"
 #include "engine.h"
+#include "history.h"
 #include "config.h"
 #include <WiFi.h>
 #include <SPIFFS.h>
 #include <ArduinoJson.h>
 
 AsyncWebServer server(80);
+AsyncEventSource events("/api/events");
+
+#define TEMP_UNKNOWN INT16_MIN
+
+StatusSnapshot _sent;
+volatile bool _resync = false; // Set from the server's task on a connect
+uint32_t _pushedVersion = 0;
+uint32_t _eventId = 0;
+unsigned long _lastCheck = 0;
+unsigned long _lastPush = 0;
+
+// The cached /api/status
+char _statusJson[2][STATUS_BUFFER_SIZE];
+size_t _statusLen[2] = {0, 0};
+char _statusETag[2][12];
+uint8_t _statusCurrent = 0;
+uint8_t _statusInFlight[2] = {0, 0}; // 200 responses still streaming each copy
+bool _statusValid = false;
+uint32_t _statusVersion = 0;
+unsigned long _statusBuiltAt = 0;
+
+// For /api/diag
+uint32_t _statusRequests = 0;
+uint32_t _statusNotModified = 0;
+uint32_t _statusRebuilds = 0;
+uint32_t _statusBusySkips = 0;
+uint32_t _statusMicros = 0;
+
+// The rows of an /api/history response, kept until it's gone, so there is
+// one at a time
+HistoryRow _historyRows[HISTORY_MAX_POINTS];
+size_t _historyCount = 0;
+bool _historyBusy = false;
+size_t _csvRow = 0;
+char _csvLine[64];
+size_t _csvLen = 0;
+size_t _csvPos = 0;
+
+// /api/status, declared as a handler rather than with server.on() so it
+// can ask for If-None-Match: the server drops headers no handler asked for
+class StatusHandler : public AsyncWebHandler {
+public:
+    bool canHandle(AsyncWebServerRequest *request) override {
+        if (request->method() != HTTP_GET || request->url() != "/api/status") return false;
+        request->addInterestingHeader("If-None-Match");
+        return true;
+    }
+    void handleRequest(AsyncWebServerRequest *request) override {
+        WebManager::_handleAPIStatus(request);
+    }
+};
+
+// FNV-1a, as a quoted ETag
+static void _etag(const char* data, size_t len, char* out) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        h ^= (uint8_t)data[i];
+        h *= 16777619u;
+    }
+    snprintf(out, 12, "\"%08x\"", (unsigned)h);
+}
+
+static int16_t _tenths(float f) {
+    return isnan(f) ? TEMP_UNKNOWN : (int16_t)lroundf(f * 10);
+}
+
+static float _fromTenths(int16_t t) {
+    return t / 10.0f;
+}
+
+// A from or to parameter: seconds since boot, or if negative, seconds
+// before now
+static uint32_t _historyTime(AsyncWebServerRequest *request, const char* name, uint32_t now, long fallback) {
+    long t = request->hasParam(name) ? request->getParam(name)->value().toInt() : fallback;
+    if (t >= 0) return t;
+    return (unsigned long)-t > now ? 0 : now + t;
+}
+
+static size_t _historyCsvLine(const HistoryRow& row, char* line, size_t size) {
+    const HistoryPoint& p = row.point;
+    char temp[8] = "";
+    if (p.temp != HISTORY_TEMP_UNKNOWN) snprintf(temp, sizeof(temp), "%.1f", _fromTenths(p.temp));
+    return snprintf(line, size, "%u,%s,%.1f,%.2f,%.2f,%.2f,%.2f\n", (unsigned)row.time, temp,
+        _fromTenths(p.target), p.heat / 255.0f, p.cool / 255.0f, p.fan / 255.0f, p.failsafe / 255.0f);
+}
+
+// Fill a chunk with as much of the CSV as fits, a row at a time
+static size_t _fillHistoryCsv(char* buffer, size_t maxLen) {
+    size_t written = 0;
+    while (written < maxLen) {
+        if (_csvPos == _csvLen) {
+            if (_csvRow == _historyCount) break;
+            _csvLen = _historyCsvLine(_historyRows[_csvRow++], _csvLine, sizeof(_csvLine));
+            _csvPos = 0;
+        }
+        size_t n = min(maxLen - written, _csvLen - _csvPos);
+        memcpy(buffer + written, _csvLine + _csvPos, n);
+        written += n;
+        _csvPos += n;
+    }
+    return written;
+}
 
 void WebManager::init() {
     Serial.println("[Web] Initializing Web Server...");
@@ -23,10 +126,27 @@ void WebManager::init() {
 }
 
 void WebManager::_setupRoutes() {
-    server.serveStatic("/", SPIFFS, "/").setDefaultFile("index.html");
+    // The image holds gzipped files (tools/build_web_assets.py); serveStatic()
+    // sends name.gz for name. Assets are named by content hash and never
+    // change; index.html names the current ones, so it is cached briefly
+    server.serveStatic("/assets/", SPIFFS, "/assets/").setCacheControl("public, max-age=31536000, immutable");
+    server.serveStatic("/", SPIFFS, "/").setDefaultFile("index.html").setCacheControl("max-age=60");
 
     // API: Get Status
-    server.on("/api/status", HTTP_GET, _handleAPIStatus);
+    server.addHandler(new StatusHandler());
+
+    // API: Request and heap counters
+    server.on("/api/diag", HTTP_GET, _handleAPIDiag);
+
+    // API: Temperature, target, relay and failsafe history
+    server.on("/api/history", HTTP_GET, _handleAPIHistory);
+
+    // API: Status push. update() sends a new client the whole document,
+    // then the changes
+    events.onConnect([](AsyncEventSourceClient *client) {
+        _resync = true;
+    });
+    server.addHandler(&events);
 
     // API: Set Mode
     server.on("/api/mode", HTTP_POST, [](AsyncWebServerRequest *request){}, NULL, 
@@ -89,10 +209,7 @@ void WebManager::_setupRoutes() {
     });
 }
 
-void WebManager::_handleAPIStatus(AsyncWebServerRequest *request) {
-    // 1024 bytes should be enough for our status JSON
-    JsonDocument doc; // ArduinoJson v7 handles memory automatically
-    
+void WebManager::_buildStatus(JsonDocument& doc) {
     ThermoEngine::populateStatusJson(doc);
     
     doc["ip"] = WiFi.localIP().toString();
@@ -101,8 +218,219 @@ void WebManager::_handleAPIStatus(AsyncWebServerRequest *request) {
     
     JsonObject halObj = doc["hal"].to<JsonObject>();
     HAL::populateStatusJson(halObj);
+}
+
+void WebManager::_refreshStatus() {
+    unsigned long now = millis();
+    uint32_t version = ThermoEngine::getVersion() + HAL::getVersion();
+    if (_statusValid) {
+        if (version == _statusVersion && now - _statusBuiltAt < STATUS_MAX_AGE_MS) return;
+        if (now - _statusBuiltAt < STATUS_MIN_REBUILD_MS) return;
+    }
+
+    // beginResponse_P() streams from the buffer as the client reads, so the
+    // other copy can't be rewritten while a slow client is still on it;
+    // serve the current one until it's free
+    uint8_t next = _statusValid ? 1 - _statusCurrent : 0;
+    if (_statusInFlight[next]) {
+        _statusBusySkips++;
+        return;
+    }
+
+    JsonDocument doc; // ArduinoJson v7 handles memory automatically
+    _buildStatus(doc);
+    size_t len = serializeJson(doc, _statusJson[next], STATUS_BUFFER_SIZE);
+    if (len == 0 || len >= STATUS_BUFFER_SIZE - 1) {
+        Serial.println("[Web] Status JSON exceeds STATUS_BUFFER_SIZE!");
+        return;
+    }
+    _statusLen[next] = len;
+    _etag(_statusJson[next], len, _statusETag[next]);
+    _statusCurrent = next;
+    _statusValid = true;
+    _statusVersion = version;
+    _statusBuiltAt = now;
+    _statusRebuilds++;
+}
+
+// Requests share the cached bytes; a client sending back the ETag of the
+// current copy gets a 304 without them
+void WebManager::_handleAPIStatus(AsyncWebServerRequest *request) {
+    unsigned long start = micros();
+    _refreshStatus();
+    if (!_statusValid) {
+        request->send(500, "application/json", "{\"error\":\"Status unavailable\"}");
+        return;
+    }
+
+    const char* etag = _statusETag[_statusCurrent];
+    AsyncWebServerResponse *response;
+    AsyncWebHeader *match = request->getHeader("If-None-Match");
+    if (match && match->value() == etag) {
+        response = request->beginResponse(304);
+        _statusNotModified++;
+    } else {
+        uint8_t current = _statusCurrent;
+        response = request->beginResponse_P(200, "application/json",
+            (const uint8_t*)_statusJson[current], _statusLen[current]);
+        _statusInFlight[current]++;
+        request->onDisconnect([current]() { _statusInFlight[current]--; });
+    }
+    response->addHeader("ETag", etag);
+    response->addHeader("Cache-Control", "no-cache");
+    request->send(response);
+
+    _statusRequests++;
+    _statusMicros += micros() - start;
+}
+
+void WebManager::_handleAPIDiag(AsyncWebServerRequest *request) {
+    JsonDocument doc;
+    JsonObject status = doc["status"].to<JsonObject>();
+    status["requests"] = _statusRequests;
+    status["notModified"] = _statusNotModified;
+    status["rebuilds"] = _statusRebuilds;
+    status["busySkips"] = _statusBusySkips;
+    status["avgUs"] = _statusRequests ? _statusMicros / _statusRequests : 0;
+
+    JsonObject heap = doc["heap"].to<JsonObject>();
+    heap["free"] = ESP.getFreeHeap();
+    heap["minFree"] = ESP.getMinFreeHeap();
+    heap["maxAlloc"] = ESP.getMaxAllocHeap();
+
+    JsonObject hal = doc["hal"].to<JsonObject>();
+    HAL::populateDiagJson(hal);
+    doc["uptime"] = millis() / 1000;
 
     String response;
     serializeJson(doc, response);
     request->send(200, "application/json", response);
 }
+
+// /api/history?from=&to=&points=&format=csv|bin: the history between from
+// and to (by default the last HISTORY_DEFAULT_SPAN_S), downsampled to at
+// most points rows. CSV has a header line and one row per point; bin is
+// the HistoryRow array. X-History-Now is the time of the newest sample
+void WebManager::_handleAPIHistory(AsyncWebServerRequest *request) {
+    if (_historyBusy) {
+        AsyncWebServerResponse *response = request->beginResponse(503, "application/json", "{\"error\":\"History busy\"}");
+        response->addHeader("Retry-After", "1");
+        request->send(response);
+        return;
+    }
+
+    String format = request->hasParam("format") ? request->getParam("format")->value() : "csv";
+    if (format != "csv" && format != "bin") {
+        request->send(400, "application/json", "{\"error\":\"format must be csv or bin\"}");
+        return;
+    }
+    uint32_t now = History::now();
+    uint32_t from = _historyTime(request, "from", now, -HISTORY_DEFAULT_SPAN_S);
+    uint32_t to = _historyTime(request, "to", now, now);
+    if (from > to) {
+        request->send(400, "application/json", "{\"error\":\"from is after to\"}");
+        return;
+    }
+    long points = request->hasParam("points") ? request->getParam("points")->value().toInt() : HISTORY_DEFAULT_POINTS;
+    points = constrain(points, 3, HISTORY_MAX_POINTS);
+
+    _historyCount = History::query(from, to, points, _historyRows);
+    _historyBusy = true;
+    request->onDisconnect([]() { _historyBusy = false; });
+
+    AsyncWebServerResponse *response;
+    if (format == "bin") {
+        response = request->beginResponse_P(200, "application/octet-stream",
+            (const uint8_t*)_historyRows, _historyCount * sizeof(HistoryRow));
+    } else {
+        _csvRow = 0;
+        _csvLen = strlcpy(_csvLine, "time,temp,target,heat,cool,fan,failsafe\n", sizeof(_csvLine));
+        _csvPos = 0;
+        response = request->beginChunkedResponse("text/csv", [](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+            return _fillHistoryCsv((char*)buffer, maxLen);
+        });
+    }
+    response->addHeader("X-History-Now", String(now));
+    response->addHeader("Cache-Control", "no-cache");
+    request->send(response);
+}
+
+void WebManager::update() {
+    if (events.count() == 0) return;
+
+    // Nothing to look at unless something changed or a check is due
+    unsigned long now = millis();
+    uint32_t version = ThermoEngine::getVersion() + HAL::getVersion();
+    if (!_resync && version == _pushedVersion && now - _lastCheck < PUSH_CHECK_MS) return;
+    _pushedVersion = version;
+    _lastCheck = now;
+
+    StatusSnapshot snap;
+    _takeSnapshot(snap);
+    JsonDocument doc;
+    if (_resync) {
+        // Everyone gets the whole document; the new client needs it and the
+        // others lose nothing
+        _resync = false;
+        _sent = snap;
+        _buildStatus(doc);
+        String msg;
+        serializeJson(doc, msg);
+        events.send(msg.c_str(), "status", ++_eventId);
+        _lastPush = now;
+    } else if (_writeDelta(doc, snap, _sent)) {
+        _sent = snap;
+        _push(doc, "delta");
+    } else if (now - _lastPush >= PUSH_HEARTBEAT_MS) {
+        doc["rssi"] = WiFi.RSSI();
+        doc["hal"]["uptime"] = millis() / 1000;
+        _push(doc, "ping");
+    }
+}
+
+void WebManager::_push(JsonDocument& doc, const char* event) {
+    char msg[256];
+    serializeJson(doc, msg, sizeof(msg));
+    events.send(msg, event, ++_eventId);
+    _lastPush = millis();
+}
+
+void WebManager::_takeSnapshot(StatusSnapshot& snap) {
+    snap.mode = ThermoEngine::getMode();
+    snap.state = ThermoEngine::getState();
+    snap.target = _tenths(ThermoEngine::getTargetTemp());
+    snap.effTemp = _tenths(ThermoEngine::getEffectiveTemp());
+    snap.usingRemote = ThermoEngine::isUsingRemote();
+    snap.failsafe = HAL::isFailsafe();
+    snap.halTemp = _tenths(HAL::readTempF());
+    snap.sensorOk = HAL::isSensorValid();
+    snap.relays = 0;
+    for (int i = 0; i < RELAY_COUNT; i++) {
+        if (HAL::getRelay((RelayID)i)) snap.relays |= 1 << i;
+    }
+}
+
+// The fields of now that differ from sent, named and nested as in
+// /api/status. Returns false if none do
+bool WebManager::_writeDelta(JsonDocument& doc, const StatusSnapshot& now, const StatusSnapshot& sent) {
+    if (now.mode != sent.mode) doc["mode"] = now.mode;
+    if (now.state != sent.state) doc["state"] = now.state;
+    if (now.target != sent.target) doc["target"] = _fromTenths(now.target);
+    if (now.effTemp != sent.effTemp) {
+        if (now.effTemp == TEMP_UNKNOWN) doc["effTemp"] = nullptr;
+        else doc["effTemp"] = _fromTenths(now.effTemp);
+    }
+    if (now.usingRemote != sent.usingRemote) doc["usingRemote"] = now.usingRemote;
+
+    if (now.failsafe != sent.failsafe) doc["hal"]["failsafe"] = now.failsafe;
+    if (now.halTemp != sent.halTemp) {
+        if (now.halTemp == TEMP_UNKNOWN) doc["hal"]["temp"] = nullptr;
+        else doc["hal"]["temp"] = _fromTenths(now.halTemp);
+    }
+    if (now.sensorOk != sent.sensorOk) doc["hal"]["sensorOk"] = now.sensorOk;
+    if (now.relays != sent.relays) {
+        JsonArray relays = doc["hal"]["relays"].to<JsonArray>();
+        for (int i = 0; i < RELAY_COUNT; i++) relays.add((now.relays >> i) & 1);
+    }
+    return doc.size() > 0;
+}
@@ -4,14 +4,57 @@
 #include <Arduino.h>
 #include <AsyncTCP.h>
 #include <ESPAsyncWebServer.h>
+#include <ArduinoJson.h>
+
+// Status pushed to /api/events: "status" (the whole /api/status document)
+// when a client connects, "delta" (only the fields that changed, same
+// shape) within a loop() of a change, "ping" (uptime, rssi) when nothing
+// was sent for PUSH_HEARTBEAT_MS.
+#define PUSH_CHECK_MS     1000   // Look for time-driven changes (remote temp timeout)
+#define PUSH_HEARTBEAT_MS 15000
+
+// /api/status is serialized into one of two buffers, only when the engine
+// or HAL version moves or the copy is STATUS_MAX_AGE_MS old (uptime,
+// RSSI), and not more often than STATUS_MIN_REBUILD_MS, so a response still
+// going out of the other buffer isn't overwritten under it
+#define STATUS_BUFFER_SIZE     512
+#define STATUS_MAX_AGE_MS      5000
+#define STATUS_MIN_REBUILD_MS  250
+
+// /api/history with no from or points
+#define HISTORY_DEFAULT_SPAN_S  3600
+#define HISTORY_DEFAULT_POINTS  300
+
+// What the UI was last sent, in the units it displays
+struct StatusSnapshot {
+    int8_t   mode;
+    int8_t   state;
+    int16_t  target;      // 0.1 F
+    int16_t  effTemp;     // 0.1 F, TEMP_UNKNOWN if NAN
+    bool     usingRemote;
+    bool     failsafe;
+    int16_t  halTemp;     // 0.1 F, TEMP_UNKNOWN if NAN
+    bool     sensorOk;
+    uint8_t  relays;      // Bit per RelayID
+};
 
 class WebManager {
+    friend class StatusHandler;
+
 public:
     static void init();
+    static void update(); // Push changes to /api/events; call from loop()
     
 private:
     static void _setupRoutes();
+    static void _buildStatus(JsonDocument& doc);
+    static void _takeSnapshot(StatusSnapshot& snap);
+    static bool _writeDelta(JsonDocument& doc, const StatusSnapshot& now, const StatusSnapshot& sent);
+    static void _push(JsonDocument& doc, const char* event);
     static void _handleAPIStatus(AsyncWebServerRequest *request);
+    static void _handleAPIDiag(AsyncWebServerRequest *request);
+    static void _handleAPIHistory(AsyncWebServerRequest *request);
+    static void _refreshStatus();
     static void _handleAPISetMode(AsyncWebServerRequest *request);
     static void _handleAPISetTarget(AsyncWebServerRequest *request);
 };
@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+"""Measure /api/status on a ThermoGuard (or esp32_hvac_mpc) device.
+
+Hammers GET /api/status from a few connections for a while, once plain and
+once sending back the ETag (If-None-Match), and prints requests per second
+and how many came back 304. For ThermoGuard it also reads /api/diag before
+and after each run: the device's own count of requests, cache rebuilds,
+average handling time and the heap low-water mark.
+
+Usage: tools/bench_status.py [host [seconds [connections]]]
+       (default thermoguard.local, 10 s, 4 connections)
+"""
+
+import http.client
+import json
+import sys
+import threading
+import time
+
+
+def get(conn, path, headers=None):
+    conn.request('GET', path, headers=headers or {})
+    res = conn.getresponse()
+    body = res.read()
+    return res.status, res.getheader('ETag'), body
+
+
+def diag(host):
+    try:
+        conn = http.client.HTTPConnection(host, 80, timeout=5)
+        status, _, body = get(conn, '/api/diag')
+        return json.loads(body) if status == 200 else None
+    except (OSError, ValueError):
+        return None
+
+
+def run(host, seconds, connections, conditional):
+    counts = {'ok': 0, 'not_modified': 0, 'errors': 0}
+    lock = threading.Lock()
+    stop = time.monotonic() + seconds
+
+    def worker():
+        conn = http.client.HTTPConnection(host, 80, timeout=5)
+        etag = None
+        ok = not_modified = errors = 0
+        while time.monotonic() < stop:
+            try:
+                headers = {'If-None-Match': etag} if conditional and etag else None
+                status, tag, _ = get(conn, '/api/status', headers)
+                etag = tag or etag
+                if status == 200:
+                    ok += 1
+                elif status == 304:
+                    not_modified += 1
+                else:
+                    errors += 1
+            except (OSError, http.client.HTTPException):
+                errors += 1
+                conn.close()
+                conn = http.client.HTTPConnection(host, 80, timeout=5)
+        with lock:
+            counts['ok'] += ok
+            counts['not_modified'] += not_modified
+            counts['errors'] += errors
+
+    threads = [threading.Thread(target=worker) for _ in range(connections)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    return counts
+
+
+def main():
+    host = sys.argv[1] if len(sys.argv) > 1 else 'thermoguard.local'
+    seconds = float(sys.argv[2]) if len(sys.argv) > 2 else 10
+    connections = int(sys.argv[3]) if len(sys.argv) > 3 else 4
+
+    for conditional in (False, True):
+        before = diag(host)
+        counts = run(host, seconds, connections, conditional)
+        after = diag(host)
+        done = counts['ok'] + counts['not_modified']
+        print('%-16s %7.1f req/s  %5d x 200  %5d x 304  %3d errors' % (
+            'If-None-Match:' if conditional else 'plain:', done / seconds,
+            counts['ok'], counts['not_modified'], counts['errors']))
+        if before and after:
+            b, a = before['status'], after['status']
+            print('%-16s %d requests, %d rebuilds, %d us avg, heap min %d -> %d, max alloc %d' % (
+                '  device:', a['requests'] - b['requests'], a['rebuilds'] - b['rebuilds'],
+                a['avgUs'], before['heap']['minFree'], after['heap']['minFree'],
+                after['heap']['maxAlloc']))
+
+
+if __name__ == '__main__':
+    main()
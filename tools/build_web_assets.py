@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+"""Build the SPIFFS image contents of a web UI from its data/ directory.
+
+The firmware used to serve data/ as is: every page load read the raw HTML,
+JS and CSS from SPIFFS and sent them uncompressed with no cache headers.
+This writes, to a separate directory that becomes the image:
+
+- index.html and the other pages, minified and gzipped (name.html.gz)
+- each .js and .css a page links to, minified and gzipped under a name
+  carrying a hash of its content (assets/app.1a2b3c4d.js.gz), and the
+  pages' links rewritten to it, so the firmware can let browsers keep them
+  for good
+- anything else (e.g. thermal_brain.json) copied unchanged
+
+ESPAsyncWebServer's serveStatic() finds name.gz for name and sends it with
+Content-Encoding: gzip. Minifying only drops indentation, blank lines and
+comments that stand alone; gzip does the rest.
+
+Usage: tools/build_web_assets.py SRC_DIR OUT_DIR
+Run by tools/pio_web_assets.py on every PlatformIO build.
+"""
+
+import gzip
+import hashlib
+import os
+import re
+import shutil
+import sys
+
+ASSETS = 'assets'
+MINIFIED = ('.html', '.htm', '.js', '.css')
+
+LINK = re.compile(r'''(\b(?:src|href)\s*=\s*)(["'])(?:\./|/)?([\w.-]+\.(?:js|css))\2''')
+
+
+def minify(name, text):
+    if name.endswith('.css'):
+        text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    elif name.endswith('.js'):
+        text = re.sub(r'^\s*//[^\n]*$', '', text, flags=re.M)
+    else:
+        text = re.sub(r'<!--.*?-->', '', text, flags=re.S)
+    lines = (line.strip() for line in text.splitlines())
+    return '\n'.join(line for line in lines if line) + '\n'
+
+
+def compress(data):
+    # mtime 0: the same input gives the same image
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def write(path, data):
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+    with open(path, 'wb') as f:
+        f.write(data)
+
+
+def build(src, out):
+    """Returns {page: (bytes before, bytes after)} for a first page load."""
+    if os.path.isdir(out):
+        shutil.rmtree(out)
+    os.makedirs(out)
+
+    names = sorted(os.listdir(src))
+    pages = [n for n in names if n.endswith(('.html', '.htm'))]
+    hashed = {}
+    sizes = {}
+
+    # Linked assets first, so the pages can point at their hashed names
+    for name in names:
+        path = os.path.join(src, name)
+        if not os.path.isfile(path):
+            continue
+        with open(path, 'rb') as f:
+            raw = f.read()
+        sizes[name] = len(raw)
+        if name in pages:
+            continue
+        if name.endswith(MINIFIED):
+            data = minify(name, raw.decode('utf-8')).encode('utf-8')
+            stem, ext = os.path.splitext(name)
+            digest = hashlib.sha256(data).hexdigest()[:8]
+            hashed[name] = '%s/%s.%s%s' % (ASSETS, stem, digest, ext)
+            packed = compress(data)
+            sizes[hashed[name]] = len(packed)
+            write(os.path.join(out, hashed[name] + '.gz'), packed)
+        else:
+            shutil.copyfile(path, os.path.join(out, name))
+
+    report = {}
+    for name in pages:
+        with open(os.path.join(src, name), encoding='utf-8') as f:
+            text = f.read()
+        linked = [m.group(3) for m in LINK.finditer(text) if m.group(3) in hashed]
+        text = LINK.sub(lambda m: (m.group(1) + m.group(2) + '/' + hashed[m.group(3)] + m.group(2))
+                        if m.group(3) in hashed else m.group(0), text)
+        packed = compress(minify(name, text).encode('utf-8'))
+        write(os.path.join(out, name + '.gz'), packed)
+        before = sizes[name] + sum(sizes[a] for a in linked)
+        after = len(packed) + sum(sizes[hashed[a]] for a in linked)
+        report[name] = (before, after)
+    return report
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__.strip().splitlines()[-2])
+    src, out = sys.argv[1], sys.argv[2]
+    for page, (before, after) in build(src, out).items():
+        print('%s: %s page load %d -> %d bytes' % (os.path.relpath(out), page, before, after))
+
+
+if __name__ == '__main__':
+    main()
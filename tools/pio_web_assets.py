@@ -0,0 +1,29 @@
+"""PlatformIO pre-script: build the web UI into the SPIFFS data_dir.
+
+In platformio.ini:
+    [platformio]
+    data_dir = .pio/web
+    [env:...]
+    extra_scripts = pre:../tools/pio_web_assets.py
+    custom_web_src = data        ; optional, the default
+
+Runs tools/build_web_assets.py from custom_web_src into data_dir on every
+build, so buildfs/uploadfs always take the current sources.
+"""
+
+import os
+import sys
+
+Import("env")  # noqa: F821 (provided by SCons)
+
+project = env.subst("$PROJECT_DIR")  # noqa: F821
+sys.path.insert(0, os.path.join(project, "..", "tools"))
+from build_web_assets import build  # noqa: E402
+
+src = os.path.join(project, env.GetProjectOption("custom_web_src", "data"))  # noqa: F821
+out = env.subst("$PROJECT_DATA_DIR")  # noqa: F821
+if os.path.abspath(src) == os.path.abspath(out):
+    sys.exit("[web] data_dir must not be the web sources (%s)" % src)
+
+for page, (before, after) in build(src, out).items():
+    print("[web] %s: page load %d -> %d bytes" % (page, before, after))
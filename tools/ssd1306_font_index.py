@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+"""Generate SSD1306FontIndex.h from the arrays in SSD1306Fonts.h.
+
+The font tool's format stores each glyph's bits row by row and no glyph
+offsets, so drawString() had to sum every preceding width to find a glyph
+and then place it bit by bit. This writes, per font, the same glyphs turned
+in the layout of the display buffer, ceil(height / 8) pages of one byte
+per column, LSB at the top, and the offset of every glyph in them.
+
+Usage: tools/ssd1306_font_index.py [SSD1306Fonts.h [SSD1306FontIndex.h]]
+Re-run after adding or changing a font; the output is checked in.
+"""
+
+import os
+import re
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+DRIVER = os.path.join(HERE, '..', 'libraries', 'ESP8266_Oled_Driver_for_SSD1306_display')
+
+ARRAY = re.compile(r'const\s+char\s+(\w+)\[\]\s+PROGMEM\s*=\s*\{(.*?)\};', re.S)
+BYTE = re.compile(r'0x[0-9A-Fa-f]+|\b\d+\b')
+
+# Offsets are 16 bit.
+MAX_COLUMN_BYTES = 0xFFFF
+
+
+def parse(text):
+    fonts = []
+    for name, body in ARRAY.findall(text):
+        body = re.sub(r'//[^\n]*', '', body)
+        fonts.append((name, [int(b, 0) for b in BYTE.findall(body)]))
+    return fonts
+
+
+def glyphs(data):
+    """Yield (width, [(x, y), ...]) per glyph, as drawString() plots them."""
+    height, count = data[1], data[3]
+    widths = data[4:4 + count]
+    pos = 4 + count
+    for width in widths:
+        size = width * height // 8 + 1
+        bits = []
+        for i, byte in enumerate(data[pos:pos + size]):
+            for bit in range(8):
+                if byte >> bit & 1:
+                    n = i * 8 + bit
+                    bits.append((n % width, n // width))
+        pos += size
+        yield width, bits
+
+
+def index(name, data):
+    height, first, count = data[1], data[2], data[3]
+    # The last byte of a glyph can spill past its height; keep whatever the
+    # old renderer would have drawn.
+    rows = max([height] + [y + 1 for _, bits in glyphs(data) for _, y in bits])
+    pages = (rows + 7) // 8
+
+    offsets, columns = [], []
+    for width, bits in glyphs(data):
+        offsets.append(len(columns))
+        cols = [0] * (width * pages)
+        for x, y in bits:
+            cols[y // 8 * width + x] |= 1 << (y % 8)
+        columns.extend(cols)
+    if len(columns) > MAX_COLUMN_BYTES:
+        sys.exit('%s: %d column bytes do not fit 16 bit offsets' % (name, len(columns)))
+
+    out = ['// %s: %dpx high, %d glyphs from %d, %d pages' % (name, rows, count, first, pages)]
+    out.append('constexpr uint16_t %s_Offsets[] PROGMEM = {' % name)
+    out.extend(rows_of(['%d' % o for o in offsets], 12))
+    out.append('};')
+    out.append('constexpr uint8_t %s_Columns[] PROGMEM = {' % name)
+    out.extend(rows_of(['0x%02X' % c for c in columns], 16))
+    out.append('};')
+    out.append('constexpr SSD1306Font %s_Font = { %s, %d, %s_Offsets, %s_Columns };'
+               % (name, name, rows, name, name))
+    return '\n'.join(out)
+
+
+def rows_of(items, per):
+    return ['\t' + ', '.join(items[i:i + per]) + ',' for i in range(0, len(items), per)]
+
+
+def main():
+    src = sys.argv[1] if len(sys.argv) > 1 else os.path.join(DRIVER, 'SSD1306Fonts.h')
+    dst = sys.argv[2] if len(sys.argv) > 2 else os.path.join(DRIVER, 'SSD1306FontIndex.h')
+    with open(src) as f:
+        fonts = parse(f.read())
+
+    parts = [
+        '// Generated by tools/ssd1306_font_index.py from %s. Do not edit.' % os.path.basename(src),
+        '//',
+        '// Each font of %s in buffer pages with a glyph offset table, for' % os.path.basename(src),
+        '// SSD1306::setFont(const SSD1306Font &). Included from SSD1306.h.',
+        '#pragma once',
+        '',
+    ]
+    for name, data in fonts:
+        parts.append(index(name, data))
+        parts.append('')
+    with open(dst, 'w') as f:
+        f.write('\n'.join(parts))
+    print('%s: %s' % (os.path.relpath(dst), ', '.join(name for name, _ in fonts)))
+
+
+if __name__ == '__main__':
+    main()